@@ -16,6 +16,17 @@
 
 #include <set>
 #include <map>
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <memory_resource>
 
 #include <dataStructure.h>
 
@@ -38,12 +49,120 @@
 
 namespace datastructure { namespace bimap
 {
-  template < typename LEFTT, typename RIGHT>
+  // comparator / hasher / key-equal that accepts keys of other types, eg: std::less<>
+  template <typename FN>
+  concept c_transparent = requires { typename FN::is_transparent; };
+
+  /*
+   * batched find over an ordered map : the probes are visited in key order, so a probe close to
+   * the previous one is reached with a few ++ steps instead of a fresh descent from the root.
+   * Results are in probe order, map.end() for a missing key.
+   */
+  template <typename MAP, typename KEY>
+  std::vector<typename MAP::const_iterator> _sortedFindMany(const MAP& map, std::span<const KEY> probes)
+  {
+    constexpr size_t maxForwardSteps = 8;
+
+    const typename MAP::key_compare keyLessCompare = map.key_comp();
+    std::vector<size_t> probeOrder(probes.size());
+    std::iota(probeOrder.begin(), probeOrder.end(), size_t(0));
+    std::sort(probeOrder.begin(), probeOrder.end(),
+              [&probes, &keyLessCompare](size_t lhs, size_t rhs) { return keyLessCompare(probes[lhs], probes[rhs]); });
+
+    std::vector<typename MAP::const_iterator> found(probes.size(), map.cend());
+    typename MAP::const_iterator cursor = map.cbegin();
+    for(const size_t probeIdx : probeOrder)
+    {
+      const KEY& probe = probes[probeIdx];
+      for(size_t step = 0; step < maxForwardSteps && cursor != map.cend() && keyLessCompare(cursor->first, probe); ++step)
+      {
+        ++cursor;
+      }
+      if(cursor != map.cend() && keyLessCompare(cursor->first, probe))
+      {
+        cursor = map.lower_bound(probe);
+      }
+      if(cursor != map.cend() && !keyLessCompare(probe, cursor->first))
+      {
+        found[probeIdx] = cursor;
+      }
+    }
+    return found;
+  }
+
+  // a std::map / std::set node : colour and three links ahead of the value, in the common implementations
+  inline constexpr size_t _treeNodeOverhead = 4 * sizeof(void*);
+
+  template <typename T>
+  concept c_treeContainer = requires { typename T::key_compare; typename T::node_type; typename T::value_type; };
+
+  template <typename T>
+  size_t _ownedHeapBytes(const T& value);
+
+  // bytes of the nodes of a std::map / std::set and of what their values own, sizeof(tree) excluded
+  template <typename TREE>
+  size_t _treeHeapBytes(const TREE& tree)
+  {
+    using t_value = typename TREE::value_type;
+    constexpr size_t valueOffset = ((_treeNodeOverhead + alignof(t_value) - 1) / alignof(t_value)) * alignof(t_value);
+    size_t heapBytes = tree.size() * (valueOffset + sizeof(t_value));
+    if constexpr (!std::is_trivially_destructible_v<t_value>)
+    {
+      // only a value with a destructor can own memory
+      for(const t_value& value : tree)
+      {
+        heapBytes += _ownedHeapBytes(value);
+      }
+    }
+    return heapBytes;
+  }
+
+  /*
+   * bytes a value holds outside of sizeof(T) : a std::string beyond its small-string buffer,
+   * the nodes of a nested std::set, or whatever a container reports through memory_usage().
+   */
+  template <typename T>
+  size_t _ownedHeapBytes(const T& value)
+  {
+    if constexpr (requires { { value.memory_usage() } -> std::convertible_to<size_t>; })
+    {
+      return value.memory_usage() - sizeof(T);
+    } else if constexpr (c_treeContainer<T>) {
+      return _treeHeapBytes(value);
+    } else if constexpr (requires { value.first; value.second; }) {
+      return _ownedHeapBytes(value.first) + _ownedHeapBytes(value.second);
+    } else if constexpr (requires { typename T::traits_type; value.data(); value.capacity(); }) {
+      // a string held in its small-string buffer points into itself
+      const std::byte* self = reinterpret_cast<const std::byte*>(&value);
+      const std::byte* text = reinterpret_cast<const std::byte*>(value.data());
+      const std::less<const std::byte*> before;
+      if(!before(text, self) && before(text, self + sizeof(T)))
+        return 0;
+      return (value.capacity() + 1) * sizeof(typename T::value_type);
+    } else {
+      return 0;
+    }
+  }
+
+  /*
+   * ALLOC : allocator of the map nodes, rebound to each map's value_type; eg: with
+   *         std::pmr::polymorphic_allocator over a std::pmr::monotonic_buffer_resource
+   *         ( see bimap::pmr::BiMap_LR11_RL11 ) a churn of inserts never reaches the global heap,
+   *         and the nodes are released together with the resource.
+   */
+  template < typename LEFTT, typename RIGHT,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT>,
+             typename ALLOC = std::allocator<std::byte> >
   class BiMap_LR11_RL11
   {
+  public:
+    using allocator_type = ALLOC;
+    using t_lefttMap = std::map<LEFTT, RIGHT, LCMP, typename std::allocator_traits<ALLOC>::template rebind_alloc<std::pair<const LEFTT, RIGHT>>>;
+    using t_rightMap = std::map<RIGHT, LEFTT, RCMP, typename std::allocator_traits<ALLOC>::template rebind_alloc<std::pair<const RIGHT, LEFTT>>>;
+
   private:
-    std::map<LEFTT, RIGHT>  _lefttMap;
-    std::map<RIGHT, LEFTT>  _rightMap;
+    t_lefttMap  _lefttMap;
+    t_rightMap  _rightMap;
 
     const decltype(_lefttMap)& _cLefttMap;
     const decltype(_rightMap)& _cRightMap;
@@ -52,11 +171,42 @@ namespace datastructure { namespace bimap
     const typename decltype(_rightMap)::key_compare  _rightKeyLessCompare;
 
   public:
-    using lefttMapIterator = typename std::map<LEFTT, RIGHT>::iterator;
-    using rightMapIterator = typename std::map<RIGHT, LEFTT>::iterator;
+    using lefttMapIterator = typename t_lefttMap::iterator;
+    using rightMapIterator = typename t_rightMap::iterator;
 
-    using const_lefttMapIterator = typename std::map<LEFTT, RIGHT>::const_iterator;
-    using const_rightMapIterator = typename std::map<RIGHT, LEFTT>::const_iterator;
+    using const_lefttMapIterator = typename t_lefttMap::const_iterator;
+    using const_rightMapIterator = typename t_rightMap::const_iterator;
+
+    /*
+     * a left-node and its right-node detached from the maps ( see extract_left/extract_right ) :
+     * re-keyed and inserted back, a churn of erase + insert reuses both nodes instead of
+     * freeing and allocating them.
+     */
+    class node_type
+    {
+    public:
+      node_type() : _lefttNode(), _rightNode() {}
+
+      inline bool empty() const { return _lefttNode.empty(); }
+
+      inline const LEFTT& lefttKey() const { return _lefttNode.key(); }
+      inline const RIGHT& rightKey() const { return _rightNode.key(); }
+
+      // requires !empty()
+      inline void rekey(const LEFTT& lefttKey, const RIGHT& rightKey)
+      {
+        _lefttNode.key()    = lefttKey;
+        _lefttNode.mapped() = rightKey;
+        _rightNode.key()    = rightKey;
+        _rightNode.mapped() = lefttKey;
+      }
+
+    private:
+      friend class BiMap_LR11_RL11;
+
+      typename t_lefttMap::node_type  _lefttNode;
+      typename t_rightMap::node_type  _rightNode;
+    };
 
     /*
     enum InsertResult { INSERT_TRUE, LEFTT_RIGHT_EXISTS,
@@ -64,20 +214,25 @@ namespace datastructure { namespace bimap
                       };
     */
 
-    BiMap_LR11_RL11()
-      : _lefttMap(),
-        _rightMap(),
+    explicit BiMap_LR11_RL11(const ALLOC& alloc = ALLOC{})
+      : _lefttMap(LCMP{}, alloc),
+        _rightMap(RCMP{}, alloc),
         _cLefttMap(_lefttMap),
         _cRightMap(_rightMap),
         _lefttKeyLessCompare(_lefttMap.key_comp()),
         _rightKeyLessCompare(_rightMap.key_comp())
     {}
 
-    ~BiMap_LR11_RL11()
-    {
-      _lefttMap.clear();
-      _rightMap.clear();
-    }
+    // references must bind to this object's maps, not to the source's
+    BiMap_LR11_RL11(BiMap_LR11_RL11 const& other)
+      : _lefttMap(other._lefttMap),
+        _rightMap(other._rightMap),
+        _cLefttMap(_lefttMap),
+        _cRightMap(_rightMap),
+        _lefttKeyLessCompare(_lefttMap.key_comp()),
+        _rightKeyLessCompare(_rightMap.key_comp())
+    {}
+    BiMap_LR11_RL11& operator=(BiMap_LR11_RL11 const&) = delete;
 
     //inline std::pair<const_lefttMapIterator, InsertResult> insert_left(const LEFTT& lefttKey, const RIGHT& rightKey)
     inline std::pair<const_lefttMapIterator, bool> insert_left(const LEFTT& lefttKey, const RIGHT& rightKey)
@@ -136,6 +291,145 @@ namespace datastructure { namespace bimap
       }
     }
 
+    /*
+     * bulk load of (LEFTT, RIGHT) pairs sorted ascending on LEFTT : each left-node is
+     * emplaced with the previous insert position as hint, i.e amortized O(1) instead of O(log n).
+     * The right-map is not ordered by the input, so it gets a plain insert.
+     * Pairs whose left-key or right-key already exists are skipped; returns the count inserted.
+     */
+    template <typename RANGE>
+    size_t insert_sorted(const RANGE& lefttRightPairs)
+    {
+      size_t insertCount = 0;
+      const_lefttMapIterator lefttHint = _cLefttMap.cend();
+      for(const auto& [lefttKey, rightKey] : lefttRightPairs)
+      {
+        const std::pair<rightMapIterator, bool> insertRightMap = _rightMap.emplace(rightKey, lefttKey);
+        if(!insertRightMap.second)
+          continue;
+
+        const size_t sizeBefore = _lefttMap.size();
+        lefttMapIterator insertLefttMap = _lefttMap.emplace_hint(lefttHint, lefttKey, rightKey);
+        if(_lefttMap.size() == sizeBefore)
+        {
+          // lefttKey present in _lefttMap
+          _rightMap.erase(insertRightMap.first);
+          continue;
+        }
+        lefttHint = std::next(insertLefttMap);
+        ++insertCount;
+      }
+      return insertCount;
+    }
+
+    inline bool erase_left(const LEFTT& lefttKey)
+    {
+      lefttMapIterator lefttMapSearch = _lefttMap.find(lefttKey);
+      if(lefttMapSearch == _lefttMap.end())
+        return false;
+
+      _rightMap.erase(lefttMapSearch->second);
+      _lefttMap.erase(lefttMapSearch);
+      return true;
+    }
+
+    inline bool erase_right(const RIGHT& rightKey)
+    {
+      rightMapIterator rightMapSearch = _rightMap.find(rightKey);
+      if(rightMapSearch == _rightMap.end())
+        return false;
+
+      _lefttMap.erase(rightMapSearch->second);
+      _rightMap.erase(rightMapSearch);
+      return true;
+    }
+
+    /*
+     * renames a left-key, keeping its right-key : the left-node is extracted, re-keyed and
+     * re-inserted, so no node is freed or allocated.
+     * Returns false if 'oldLefttKey' is absent or 'newLefttKey' already exists.
+     * The new key is copied before either map changes, so a throwing copy leaves the bimap as it was.
+     */
+    inline bool rekey_left(const LEFTT& oldLefttKey, const LEFTT& newLefttKey)
+    {
+      lefttMapIterator oldLefttSearch = _lefttMap.find(oldLefttKey);
+      if(oldLefttSearch == _lefttMap.end() || _lefttMap.contains(newLefttKey))
+        return false;
+
+      LEFTT rightNodeValue{newLefttKey};
+      LEFTT lefttNodeKey{newLefttKey};
+      _rightMap.find(oldLefttSearch->second)->second = std::move(rightNodeValue);
+      auto lefttNode = _lefttMap.extract(oldLefttSearch);
+      lefttNode.key() = std::move(lefttNodeKey);
+      _lefttMap.insert(std::move(lefttNode));
+      return true;
+    }
+
+    inline bool rekey_right(const RIGHT& oldRightKey, const RIGHT& newRightKey)
+    {
+      rightMapIterator oldRightSearch = _rightMap.find(oldRightKey);
+      if(oldRightSearch == _rightMap.end() || _rightMap.contains(newRightKey))
+        return false;
+
+      RIGHT lefttNodeValue{newRightKey};
+      RIGHT rightNodeKey{newRightKey};
+      _lefttMap.find(oldRightSearch->second)->second = std::move(lefttNodeValue);
+      auto rightNode = _rightMap.extract(oldRightSearch);
+      rightNode.key() = std::move(rightNodeKey);
+      _rightMap.insert(std::move(rightNode));
+      return true;
+    }
+
+    // detaches the pair of 'lefttKey' : an empty node_type if absent
+    inline node_type extract_left(const LEFTT& lefttKey)
+    {
+      node_type node;
+      lefttMapIterator lefttMapSearch = _lefttMap.find(lefttKey);
+      if(lefttMapSearch != _lefttMap.end())
+      {
+        node._rightNode = _rightMap.extract(lefttMapSearch->second);
+        node._lefttNode = _lefttMap.extract(lefttMapSearch);
+      }
+      return node;
+    }
+
+    inline node_type extract_right(const RIGHT& rightKey)
+    {
+      node_type node;
+      rightMapIterator rightMapSearch = _rightMap.find(rightKey);
+      if(rightMapSearch != _rightMap.end())
+      {
+        node._lefttNode = _lefttMap.extract(rightMapSearch->second);
+        node._rightNode = _rightMap.extract(rightMapSearch);
+      }
+      return node;
+    }
+
+    /*
+     * inserts an extracted pair, no allocation. Returns false, leaving 'node' as is, if it is
+     * empty or its left-key or right-key already exists.
+     */
+    inline bool insert(node_type&& node)
+    {
+      if(node.empty())
+        return false;
+
+      auto insertLefttMap = _lefttMap.insert(std::move(node._lefttNode));
+      if(!insertLefttMap.inserted)
+      {
+        node._lefttNode = std::move(insertLefttMap.node);
+        return false;
+      }
+      auto insertRightMap = _rightMap.insert(std::move(node._rightNode));
+      if(!insertRightMap.inserted)
+      {
+        node._rightNode = std::move(insertRightMap.node);
+        node._lefttNode = _lefttMap.extract(insertLefttMap.position);
+        return false;
+      }
+      return true;
+    }
+
     inline const_lefttMapIterator find_left(const LEFTT& leftKey) const
     {
       return _cLefttMap.find(leftKey);
@@ -146,6 +440,46 @@ namespace datastructure { namespace bimap
       return _cRightMap.find(rightKey);
     }
 
+    // heterogeneous lookups, eg: a std::string_view probe when LCMP/RCMP is std::less<>
+    template <typename LKEY>
+      requires c_transparent<LCMP>
+    inline const_lefttMapIterator find_left(const LKEY& leftKey) const
+    {
+      return _cLefttMap.find(leftKey);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RCMP>
+    inline const_rightMapIterator find_right(const RKEY& rightKey) const
+    {
+      return _cRightMap.find(rightKey);
+    }
+
+    // one result per probe, in probe order
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LEFTT> lefttKeys) const
+    {
+      return _sortedFindMany(_cLefttMap, lefttKeys);
+    }
+
+    template <typename LKEY>
+      requires c_transparent<LCMP>
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LKEY> lefttKeys) const
+    {
+      return _sortedFindMany(_cLefttMap, lefttKeys);
+    }
+
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RIGHT> rightKeys) const
+    {
+      return _sortedFindMany(_cRightMap, rightKeys);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RCMP>
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RKEY> rightKeys) const
+    {
+      return _sortedFindMany(_cRightMap, rightKeys);
+    }
+
     inline bool isLeft_end(const_lefttMapIterator& checkEndIter) const
     {
       return checkEndIter == _cLefttMap.end();
@@ -158,17 +492,46 @@ namespace datastructure { namespace bimap
 
     inline size_t size_left () const { return _lefttMap.size(); }
     inline size_t size_right() const { return _rightMap.size(); }
+
+    /*
+     * bytes in use : the object, the nodes of both maps and what the keys own ( eg: a long std::string ).
+     * Allocator and malloc book-keeping are not counted. O(n) for keys with a destructor.
+     */
+    inline size_t memory_usage() const
+    {
+      return sizeof(*this) + _treeHeapBytes(_cLefttMap) + _treeHeapBytes(_cRightMap);
+    }
+
+    inline ALLOC get_allocator() const { return ALLOC(_lefttMap.get_allocator()); }
+
+    inline const t_lefttMap& getLefttMap() const { return _cLefttMap; }
+    inline const t_rightMap& getRightMap() const { return _cRightMap; }
   };
 
 
 
 
-  template < typename LEFTT, typename RIGHT>
+  /*
+   * RSET : container of the right-keys of a left-key, sorted and unique with a std::set like
+   *        emplace/erase/find/contains ( see SmallSortedSet.h for an inline small-array one )
+   * ALLOC : allocator of the map nodes, as for BiMap_LR11_RL11. An allocator-aware RSET
+   *         ( eg: std::pmr::set ) is constructed with it too.
+   */
+  template < typename LEFTT, typename RIGHT,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT>,
+             typename RSET = std::set<RIGHT, RCMP>,
+             typename ALLOC = std::allocator<std::byte> >
   class BiMap_LR1M_RL11
   {
+  public:
+    using allocator_type = ALLOC;
+    using t_rightSet = RSET;
+    using t_lefttMap = std::map<LEFTT, t_rightSet, LCMP, typename std::allocator_traits<ALLOC>::template rebind_alloc<std::pair<const LEFTT, t_rightSet>>>;
+    using t_rightMap = std::map<RIGHT, LEFTT, RCMP, typename std::allocator_traits<ALLOC>::template rebind_alloc<std::pair<const RIGHT, LEFTT>>>;
+
   private:
-    std::map<LEFTT, std::set<RIGHT> >  _lefttMap1ToM;
-    std::map<RIGHT, LEFTT>             _rightMap1To1;
+    t_lefttMap  _lefttMap1ToM;
+    t_rightMap  _rightMap1To1;
 
     const decltype(_lefttMap1ToM)& _cLefttMap1ToM;
     const decltype(_rightMap1To1)& _cRightMap1To1;
@@ -177,33 +540,34 @@ namespace datastructure { namespace bimap
     const typename decltype(_rightMap1To1)::key_compare  _rightKeyLessCompare;
 
   public:
-    using lefttMapIterator = typename std::map<LEFTT, std::set<RIGHT>>::iterator;
-    using rightMapIterator = typename std::map<RIGHT, LEFTT>::iterator;
-    using rightSetIterator = typename std::set<RIGHT     >::iterator;
+    using lefttMapIterator = typename t_lefttMap::iterator;
+    using rightMapIterator = typename t_rightMap::iterator;
+    using rightSetIterator = typename t_rightSet::iterator;
 
-    using const_lefttMapIterator = typename std::map<LEFTT, std::set<RIGHT>>::const_iterator;
-    using const_rightMapIterator = typename std::map<RIGHT, LEFTT>::const_iterator;
-    using const_rightSetIterator = typename std::set<RIGHT     >::const_iterator;
+    using const_lefttMapIterator = typename t_lefttMap::const_iterator;
+    using const_rightMapIterator = typename t_rightMap::const_iterator;
+    using const_rightSetIterator = typename t_rightSet::const_iterator;
 
 
-    BiMap_LR1M_RL11()
-      : _lefttMap1ToM(),
-        _rightMap1To1(),
+    explicit BiMap_LR1M_RL11(const ALLOC& alloc = ALLOC{})
+      : _lefttMap1ToM(LCMP{}, alloc),
+        _rightMap1To1(RCMP{}, alloc),
         _cLefttMap1ToM(_lefttMap1ToM),
         _cRightMap1To1(_rightMap1To1),
         _lefttKeyLessCompare(_lefttMap1ToM.key_comp()),
         _rightKeyLessCompare(_rightMap1To1.key_comp())
     {}
 
-    ~BiMap_LR1M_RL11()
-    {
-      for(auto& manySet : _lefttMap1ToM)
-      {
-        manySet.second.clear();
-      }
-      _lefttMap1ToM.clear();
-      _rightMap1To1.clear();
-    }
+    // references must bind to this object's maps, not to the source's
+    BiMap_LR1M_RL11(BiMap_LR1M_RL11 const& other)
+      : _lefttMap1ToM(other._lefttMap1ToM),
+        _rightMap1To1(other._rightMap1To1),
+        _cLefttMap1ToM(_lefttMap1ToM),
+        _cRightMap1To1(_rightMap1To1),
+        _lefttKeyLessCompare(_lefttMap1ToM.key_comp()),
+        _rightKeyLessCompare(_rightMap1To1.key_comp())
+    {}
+    BiMap_LR1M_RL11& operator=(BiMap_LR1M_RL11 const&) = delete;
 
     inline std::pair<const_lefttMapIterator, bool> insert_left(const LEFTT& lefttKey, const RIGHT& rightKey)
     {
@@ -221,10 +585,10 @@ namespace datastructure { namespace bimap
       // In rightMap : rightKey doesn't exists
 
       // if existing left-node use that ELSE create a new left-node.
-      std::pair<lefttMapIterator, bool> insertLeftMap = _lefttMap1ToM.emplace(lefttKey, std::set<RIGHT>{} );
+      std::pair<lefttMapIterator, bool> insertLeftMap = _lefttMap1ToM.emplace(lefttKey, t_rightSet{} );
       // no need to check on insertLeftMap.second
       lefttMapIterator lefttMapSearch = insertLeftMap.first;
-      std::set<RIGHT>& rightSetKeys = lefttMapSearch->second;
+      t_rightSet& rightSetKeys = lefttMapSearch->second;
 
       const std::pair<rightSetIterator, bool> insertRightSet = rightSetKeys.emplace(rightKey);
       if(!insertRightSet.second)
@@ -254,6 +618,118 @@ namespace datastructure { namespace bimap
       return { const_lefttMapIterator(lefttMapSearch), insertRightSet.second };
     }
 
+    /*
+     * bulk load of (LEFTT, RIGHT) pairs sorted ascending on LEFTT : consecutive pairs of a
+     * left-key share one left-node lookup, and a new left-node is emplaced with the previous
+     * one as hint. Pairs whose right-key already exists are skipped; returns the count inserted.
+     */
+    template <typename RANGE>
+    size_t insert_sorted(const RANGE& lefttRightPairs)
+    {
+      size_t insertCount = 0;
+      lefttMapIterator lefttHint = _lefttMap1ToM.end();
+      for(const auto& [lefttKey, rightKey] : lefttRightPairs)
+      {
+        const std::pair<rightMapIterator, bool> insertRightMap = _rightMap1To1.emplace(rightKey, lefttKey);
+        if(!insertRightMap.second)
+          continue;
+
+        if( lefttHint == _lefttMap1ToM.end() ||
+            _lefttKeyLessCompare(lefttHint->first, lefttKey) || _lefttKeyLessCompare(lefttKey, lefttHint->first) )
+        {
+          // not the left-node of the previous pair
+          lefttHint = _lefttMap1ToM.emplace_hint(lefttHint == _lefttMap1ToM.end() ? lefttHint : std::next(lefttHint),
+                                                 lefttKey, t_rightSet{});
+        }
+        lefttHint->second.emplace(rightKey);
+        ++insertCount;
+      }
+      return insertCount;
+    }
+
+    // erases 'lefttKey' and all its right-keys; returns the count of right-keys erased
+    inline size_t erase_left(const LEFTT& lefttKey)
+    {
+      lefttMapIterator lefttMapSearch = _lefttMap1ToM.find(lefttKey);
+      if(lefttMapSearch == _lefttMap1ToM.end())
+        return 0;
+
+      const size_t eraseCount = lefttMapSearch->second.size();
+      for(const RIGHT& rightKey : lefttMapSearch->second)
+      {
+        _rightMap1To1.erase(rightKey);
+      }
+      _lefttMap1ToM.erase(lefttMapSearch);
+      return eraseCount;
+    }
+
+    // the left-key is erased along with its last right-key
+    inline bool erase_right(const RIGHT& rightKey)
+    {
+      rightMapIterator rightMapSearch = _rightMap1To1.find(rightKey);
+      if(rightMapSearch == _rightMap1To1.end())
+        return false;
+
+      lefttMapIterator lefttMapSearch = _lefttMap1ToM.find(rightMapSearch->second);
+      lefttMapSearch->second.erase(rightKey);
+      if(lefttMapSearch->second.empty())
+      {
+        _lefttMap1ToM.erase(lefttMapSearch);
+      }
+      _rightMap1To1.erase(rightMapSearch);
+      return true;
+    }
+
+    /*
+     * rekey_left / rekey_right : nodes are extracted, re-keyed and re-inserted, so no node is
+     * freed or allocated. Return false if the old key is absent or the new key already exists.
+     * The copies of the new key are made before either map changes, a throwing copy leaves the bimap as it was.
+     */
+    inline bool rekey_left(const LEFTT& oldLefttKey, const LEFTT& newLefttKey)
+    {
+      lefttMapIterator oldLefttSearch = _lefttMap1ToM.find(oldLefttKey);
+      if(oldLefttSearch == _lefttMap1ToM.end() || _lefttMap1ToM.contains(newLefttKey))
+        return false;
+
+      std::vector<LEFTT> rightNodeValues(oldLefttSearch->second.size(), newLefttKey);
+      LEFTT lefttNodeKey{newLefttKey};
+      auto rightNodeValue = rightNodeValues.begin();
+      for(const RIGHT& rightKey : oldLefttSearch->second)
+      {
+        _rightMap1To1.find(rightKey)->second = std::move(*rightNodeValue++);
+      }
+      auto lefttNode = _lefttMap1ToM.extract(oldLefttSearch);
+      lefttNode.key() = std::move(lefttNodeKey);
+      _lefttMap1ToM.insert(std::move(lefttNode));
+      return true;
+    }
+
+    inline bool rekey_right(const RIGHT& oldRightKey, const RIGHT& newRightKey)
+    {
+      rightMapIterator oldRightSearch = _rightMap1To1.find(oldRightKey);
+      if(oldRightSearch == _rightMap1To1.end() || _rightMap1To1.contains(newRightKey))
+        return false;
+
+      RIGHT rightSetKey{newRightKey};
+      RIGHT rightNodeKey{newRightKey};
+      t_rightSet& rightSetKeys = _lefttMap1ToM.find(oldRightSearch->second)->second;
+      if constexpr (requires { rightSetKeys.extract(oldRightKey); })
+      {
+        auto rightSetNode = rightSetKeys.extract(oldRightKey);
+        rightSetNode.value() = std::move(rightSetKey);
+        rightSetKeys.insert(std::move(rightSetNode));
+      } else {
+        // array backed set : the freed slot is reused, no allocation either
+        rightSetKeys.erase(oldRightKey);
+        rightSetKeys.emplace(std::move(rightSetKey));
+      }
+
+      auto rightNode = _rightMap1To1.extract(oldRightSearch);
+      rightNode.key() = std::move(rightNodeKey);
+      _rightMap1To1.insert(std::move(rightNode));
+      return true;
+    }
+
     inline const_lefttMapIterator find_left(const LEFTT& lefttKey) const
     {
       return _cLefttMap1ToM.find(lefttKey);
@@ -264,6 +740,46 @@ namespace datastructure { namespace bimap
       return _cRightMap1To1.find(rightKey);
     }
 
+    // heterogeneous lookups, eg: a std::string_view probe when LCMP/RCMP is std::less<>
+    template <typename LKEY>
+      requires c_transparent<LCMP>
+    inline const_lefttMapIterator find_left(const LKEY& lefttKey) const
+    {
+      return _cLefttMap1ToM.find(lefttKey);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RCMP>
+    inline const_rightMapIterator find_right(const RKEY& rightKey) const
+    {
+      return _cRightMap1To1.find(rightKey);
+    }
+
+    // one result per probe, in probe order
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LEFTT> lefttKeys) const
+    {
+      return _sortedFindMany(_cLefttMap1ToM, lefttKeys);
+    }
+
+    template <typename LKEY>
+      requires c_transparent<LCMP>
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LKEY> lefttKeys) const
+    {
+      return _sortedFindMany(_cLefttMap1ToM, lefttKeys);
+    }
+
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RIGHT> rightKeys) const
+    {
+      return _sortedFindMany(_cRightMap1To1, rightKeys);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RCMP>
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RKEY> rightKeys) const
+    {
+      return _sortedFindMany(_cRightMap1To1, rightKeys);
+    }
+
     inline bool isLeft_end(const_lefttMapIterator& checkEndIter) const
     {
       return checkEndIter == _cLefttMap1ToM.end();
@@ -280,7 +796,7 @@ namespace datastructure { namespace bimap
       if(primIter == _cLefttMap1ToM.end())
         return false;
 
-      return primIter->contains(rightKey);
+      return primIter->second.contains(rightKey);
     }
 
     inline bool contains_right(const RIGHT& rightKey, const LEFTT& leftKey) const
@@ -289,12 +805,42 @@ namespace datastructure { namespace bimap
       if(secoIter == _cRightMap1To1.end())
         return false;
 
-      return secoIter->contains(leftKey);
+      return !_lefttKeyLessCompare(secoIter->second, leftKey) &&
+             !_lefttKeyLessCompare(leftKey, secoIter->second);
     }
 
     inline size_t size_left () const { return _lefttMap1ToM.size(); }
     inline size_t size_right() const { return _rightMap1To1.size(); }
+
+    // bytes in use : the object, both maps' nodes, the right-key sets and what the keys own
+    inline size_t memory_usage() const
+    {
+      return sizeof(*this) + _treeHeapBytes(_cLefttMap1ToM) + _treeHeapBytes(_cRightMap1To1);
+    }
+
+    inline ALLOC get_allocator() const { return ALLOC(_lefttMap1ToM.get_allocator()); }
+
+    inline const t_lefttMap& getLefttMap() const { return _cLefttMap1ToM; }
+    inline const t_rightMap& getRightMap() const { return _cRightMap1To1; }
   };
 
+  /*
+   * the bimaps over a std::pmr::memory_resource, eg:
+   *   std::pmr::monotonic_buffer_resource arena;
+   *   bimap::pmr::BiMap_LR11_RL11<std::pmr::string, std::pmr::string> symbolIsin(&arena);
+   * Keys such as std::pmr::string take their buffers from the same resource.
+   */
+  namespace pmr
+  {
+    template < typename LEFTT, typename RIGHT,
+               typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+    using BiMap_LR11_RL11 = bimap::BiMap_LR11_RL11<LEFTT, RIGHT, LCMP, RCMP, std::pmr::polymorphic_allocator<std::byte>>;
+
+    template < typename LEFTT, typename RIGHT,
+               typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+    using BiMap_LR1M_RL11 = bimap::BiMap_LR1M_RL11<LEFTT, RIGHT, LCMP, RCMP, std::pmr::set<RIGHT, RCMP>,
+                                                   std::pmr::polymorphic_allocator<std::byte>>;
+  }
+
 } }   //  namespace datastructure::bimap
 
@@ -0,0 +1,237 @@
+/*
+ * ConcurrentBiMap.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <functional>
+#include <type_traits>
+
+#include <biMap/BiMap.h>
+
+
+namespace datastructure { namespace bimap
+{
+  /*
+   * Concurrent-read wrapper over any copy-constructible bimap ( BiMap_LR11_RL11, BiMap_LR1M_RL11,
+   * UnorderedBiMap_* ), RCU style :
+   *
+   *   readers : read() pins the current snapshot and returns a guard; no lock is taken and the
+   *             only shared write is to the reader's own slot, so reads scale with reader threads.
+   *   writer  : update(fn) copies the current snapshot, applies fn() to the copy and publishes it
+   *             with a single atomic store. Writers are serialized among themselves.
+   *
+   * Reclamation is epoch based : a reader announces the global epoch in a slot before loading the
+   * snapshot pointer. A replaced snapshot is retired with the epoch current at its replacement and
+   * freed once no slot holds an epoch at or below it.
+   * Keep guards short lived, a pinned guard holds back reclamation of every later snapshot.
+   */
+  template < typename BIMAP, size_t READER_SLOTS = 128 >
+  class ConcurrentBiMap
+  {
+  private:
+    struct alignas(64) ReaderSlot
+    {
+      std::atomic<uint64_t>  pinnedEpoch{0};   // 0 -> slot is free
+    };
+
+    struct RetiredSnapshot
+    {
+      std::unique_ptr<const BIMAP>  snapshot;
+      uint64_t                      retireEpoch;
+    };
+
+  public:
+    using t_biMap = BIMAP;
+
+    class ReadGuard
+    {
+    public:
+      ReadGuard(ReadGuard&& other) noexcept
+        : _slot(std::exchange(other._slot, nullptr)),
+          _snapshot(std::exchange(other._snapshot, nullptr))
+      {}
+      ReadGuard(ReadGuard const&) = delete;
+      ReadGuard& operator=(ReadGuard const&) = delete;
+      ReadGuard& operator=(ReadGuard&&) = delete;
+
+      ~ReadGuard()
+      {
+        if(_slot != nullptr)
+          _slot->pinnedEpoch.store(0, std::memory_order_release);
+      }
+
+      inline const BIMAP& operator*()  const { return *_snapshot; }
+      inline const BIMAP* operator->() const { return _snapshot; }
+
+    private:
+      friend class ConcurrentBiMap;
+
+      ReadGuard(ReaderSlot* slot, const BIMAP* snapshot)
+        : _slot(slot), _snapshot(snapshot)
+      {}
+
+      ReaderSlot*   _slot;
+      const BIMAP*  _snapshot;
+    };
+
+    ConcurrentBiMap()
+      : _current(new BIMAP()),
+        _globalEpoch(1),
+        _readerSlots(),
+        _writerMutex(),
+        _retired()
+    {}
+
+    explicit ConcurrentBiMap(const BIMAP& initial)
+      : _current(new BIMAP(initial)),
+        _globalEpoch(1),
+        _readerSlots(),
+        _writerMutex(),
+        _retired()
+    {}
+
+    ConcurrentBiMap(ConcurrentBiMap const&) = delete;
+    ConcurrentBiMap& operator=(ConcurrentBiMap const&) = delete;
+
+    // no reader may be active
+    ~ConcurrentBiMap()
+    {
+      _retired.clear();
+      delete _current.load();
+    }
+
+    // lock-free : pins the current snapshot until the guard goes out of scope
+    ReadGuard read() const
+    {
+      ReaderSlot* slot = _pinSlot();
+      return ReadGuard(slot, _current.load(std::memory_order_seq_cst));
+    }
+
+    // convenience lookups, returning copies so that no snapshot stays pinned
+    template<typename KEY>
+    auto find_left(const KEY& lefttKey) const -> std::optional<std::remove_cvref_t<decltype(std::declval<const BIMAP&>().find_left(lefttKey)->second)>>
+    {
+      ReadGuard guard = read();
+      auto iter = guard->find_left(lefttKey);
+      if(guard->isLeft_end(iter))
+        return std::nullopt;
+      return iter->second;
+    }
+
+    template<typename KEY>
+    auto find_right(const KEY& rightKey) const -> std::optional<std::remove_cvref_t<decltype(std::declval<const BIMAP&>().find_right(rightKey)->second)>>
+    {
+      ReadGuard guard = read();
+      auto iter = guard->find_right(rightKey);
+      if(guard->isRight_end(iter))
+        return std::nullopt;
+      return iter->second;
+    }
+
+    /*
+     * copy-on-write batch : fn(BIMAP&) mutates a private copy, which is then published atomically.
+     * Readers see either none or all of the batch. Returns fn's result if any.
+     */
+    template<typename FN>
+    auto update(FN&& fn)
+    {
+      std::lock_guard<std::mutex> lock(_writerMutex);
+      std::unique_ptr<BIMAP> next = std::make_unique<BIMAP>(*_current.load(std::memory_order_relaxed));
+      if constexpr (std::is_void_v<std::invoke_result_t<FN, BIMAP&>>)
+      {
+        fn(*next);
+        _publish(std::move(next));
+      } else {
+        auto result = fn(*next);
+        _publish(std::move(next));
+        return result;
+      }
+    }
+
+    /*
+     * single insert, for occasional writes : it is a whole update(), so each call copies the entire
+     * bimap, O(n). Writers with more than a few inserts must batch them through one update().
+     */
+    template<typename LEFTT, typename RIGHT>
+    inline bool insert_left(const LEFTT& lefttKey, const RIGHT& rightKey)
+    {
+      return update([&lefttKey, &rightKey](BIMAP& biMap) { return biMap.insert_left(lefttKey, rightKey).second; });
+    }
+
+    // frees retired snapshots no longer visible to any reader; returns the count still pending
+    size_t reclaim()
+    {
+      std::lock_guard<std::mutex> lock(_writerMutex);
+      return _reclaim();
+    }
+
+  private:
+    std::atomic<const BIMAP*>                          _current;
+    std::atomic<uint64_t>                              _globalEpoch;
+    mutable std::array<ReaderSlot, READER_SLOTS>       _readerSlots;
+    std::mutex                                         _writerMutex;
+    std::vector<RetiredSnapshot>                       _retired;
+
+    ReaderSlot* _pinSlot() const
+    {
+      // start probing at a per-thread position, so that a thread normally reuses the same slot
+      const size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % READER_SLOTS;
+      for(size_t probe = 0; ; ++probe)
+      {
+        ReaderSlot& slot = _readerSlots[(start + probe) % READER_SLOTS];
+        uint64_t expectedFree = 0;
+        if(slot.pinnedEpoch.load(std::memory_order_relaxed) == 0 &&
+           slot.pinnedEpoch.compare_exchange_strong(expectedFree, _globalEpoch.load(std::memory_order_seq_cst),
+                                                    std::memory_order_seq_cst))
+        {
+          return &slot;
+        }
+        if(probe % READER_SLOTS == READER_SLOTS - 1)
+          std::this_thread::yield();   // more concurrent readers than slots
+      }
+    }
+
+    void _publish(std::unique_ptr<BIMAP>&& next)
+    {
+      const BIMAP* previous = _current.exchange(next.release(), std::memory_order_seq_cst);
+      // readers that can still see 'previous' pinned an epoch <= retireEpoch
+      const uint64_t retireEpoch = _globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+      _retired.push_back(RetiredSnapshot{std::unique_ptr<const BIMAP>(previous), retireEpoch});
+      _reclaim();
+    }
+
+    size_t _reclaim()
+    {
+      uint64_t minPinnedEpoch = UINT64_MAX;
+      for(const ReaderSlot& slot : _readerSlots)
+      {
+        const uint64_t pinnedEpoch = slot.pinnedEpoch.load(std::memory_order_seq_cst);
+        if(pinnedEpoch != 0 && pinnedEpoch < minPinnedEpoch)
+          minPinnedEpoch = pinnedEpoch;
+      }
+      std::erase_if(_retired, [minPinnedEpoch](const RetiredSnapshot& retired) { return retired.retireEpoch < minPinnedEpoch; });
+      return _retired.size();
+    }
+  };
+
+} }   //  namespace datastructure::bimap
@@ -0,0 +1,493 @@
+/*
+ * FrozenBiMap.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+#include <biMap/BiMap.h>
+
+
+namespace datastructure { namespace bimap
+{
+  /*
+   * lower_bound without a data-dependent branch : the loop runs exactly ceil(log2(n)) times
+   * and the comparison result selects the next base with a conditional move.
+   */
+  template<typename T, typename KEY, typename CMP>
+  inline size_t branchlessLowerBound(std::span<const T> sorted, const KEY& key, const CMP& keyLessCompare)
+  {
+    if(sorted.empty())
+      return 0;
+    const T* base = sorted.data();
+    size_t   len  = sorted.size();
+    while(len > 1)
+    {
+      const size_t half = len / 2;
+      base = keyLessCompare(base[half - 1], key) ? base + half : base;
+      len -= half;
+    }
+    return static_cast<size_t>(base - sorted.data()) + (keyLessCompare(*base, key) ? 1u : 0u);
+  }
+
+  /*
+   * flat-buffer layout of a frozen bimap :
+   *     MAGIC                                   8 bytes
+   *     [u64 count] ...                         one per array
+   *     [u64 sizeof(LEFTT)][u64 sizeof(RIGHT)]
+   *     arrays ...                              each starting on an 8 byte boundary
+   * Only for trivially copyable LEFTT/RIGHT (eg: integers, std::array<char,N>), so that a
+   * memory-mapped file can be used in place, without deserialization, by several processes.
+   */
+  class _FrozenBiMapBuffer
+  {
+  public:
+    static constexpr size_t ALIGNMENT = 8;
+
+    template<typename T>
+    static inline void appendArray(std::string& buffer, std::span<const T> array)
+    {
+      static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= ALIGNMENT);
+      buffer.append((ALIGNMENT - buffer.size() % ALIGNMENT) % ALIGNMENT, '\0');
+      buffer.append(static_cast<const char*>(static_cast<const void*>(array.data())), array.size_bytes());
+    }
+
+    static inline void appendU64(std::string& buffer, uint64_t val)
+    {
+      buffer.append(static_cast<const char*>(static_cast<const void*>(&val)), sizeof(val));
+    }
+
+    static inline uint64_t readU64(const char* data, size_t size, size_t& offset)
+    {
+      _checkBounds(size, offset, sizeof(uint64_t));
+      uint64_t val;
+      std::memcpy(&val, data + offset, sizeof(val));
+      offset += sizeof(val);
+      return val;
+    }
+
+    template<typename T>
+    static inline std::span<const T> readArray(const char* data, size_t size, size_t& offset, uint64_t count)
+    {
+      static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= ALIGNMENT);
+      offset += (ALIGNMENT - offset % ALIGNMENT) % ALIGNMENT;
+      if(count > size / sizeof(T))
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap::view() : array count is beyond the buffer size");
+      }
+      _checkBounds(size, offset, static_cast<size_t>(count) * sizeof(T));
+      const T* array = static_cast<const T*>(static_cast<const void*>(data + offset));
+      offset += static_cast<size_t>(count) * sizeof(T);
+      return std::span<const T>(array, static_cast<size_t>(count));
+    }
+
+    static inline void checkHeader(const char* data, size_t size, const char (&magic)[9])
+    {
+      if(reinterpret_cast<uintptr_t>(data) % ALIGNMENT != 0)
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap::view() : buffer is not 8 byte aligned");
+      }
+      if(size < 8 || std::memcmp(data, magic, 8) != 0)
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap::view() : buffer is not a frozen bimap of the expected kind");
+      }
+    }
+
+  private:
+    static inline void _checkBounds(size_t size, size_t offset, size_t length)
+    {
+      if(offset > size || length > size - offset)
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap::view() : truncated buffer");
+      }
+    }
+  };
+
+
+  /*
+   * Read-only BiMap_LR11_RL11 : both directions as contiguous sorted arrays ( keys and values
+   * kept in separate arrays, so the binary search touches only the densely packed keys ).
+   * Either owns its arrays, or is a view over a flat buffer produced by serialize().
+   */
+  template < typename LEFTT, typename RIGHT,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+  class FrozenBiMap_LR11_RL11
+  {
+  public:
+    static constexpr char MAGIC[9] = "DSFBM011";
+
+    // 'lefttRightPairs' in any order; throws if a left-key or a right-key repeats
+    explicit FrozenBiMap_LR11_RL11(std::vector<std::pair<LEFTT, RIGHT>> lefttRightPairs,
+                                   const LCMP& lefttKeyLessCompare = LCMP{}, const RCMP& rightKeyLessCompare = RCMP{})
+      : FrozenBiMap_LR11_RL11(lefttKeyLessCompare, rightKeyLessCompare)
+    {
+      std::sort(lefttRightPairs.begin(), lefttRightPairs.end(),
+                [this](const auto& lhs, const auto& rhs) { return _lefttKeyLessCompare(lhs.first, rhs.first); });
+      std::vector<size_t> rightOrder(lefttRightPairs.size());
+      for(size_t iii = 0; iii < rightOrder.size(); ++iii)
+        rightOrder[iii] = iii;
+      std::sort(rightOrder.begin(), rightOrder.end(),
+                [this, &lefttRightPairs](size_t lhs, size_t rhs) { return _rightKeyLessCompare(lefttRightPairs[lhs].second, lefttRightPairs[rhs].second); });
+
+      _reserve(lefttRightPairs.size());
+      for(size_t iii = 0; iii < lefttRightPairs.size(); ++iii)
+      {
+        if(iii > 0 && !_lefttKeyLessCompare(lefttRightPairs[iii-1].first, lefttRightPairs[iii].first))
+        {
+          throw std::invalid_argument("ERROR : FrozenBiMap_LR11_RL11() : duplicate left-key");
+        }
+        if(iii > 0 && !_rightKeyLessCompare(lefttRightPairs[rightOrder[iii-1]].second, lefttRightPairs[rightOrder[iii]].second))
+        {
+          throw std::invalid_argument("ERROR : FrozenBiMap_LR11_RL11() : duplicate right-key");
+        }
+        _lefttKeysOwned.push_back(lefttRightPairs[iii].first);
+        _lefttValuesOwned.push_back(lefttRightPairs[iii].second);
+        _rightKeysOwned.push_back(lefttRightPairs[rightOrder[iii]].second);
+        _rightValuesOwned.push_back(lefttRightPairs[rightOrder[iii]].first);
+      }
+      _attachOwned();
+    }
+
+    FrozenBiMap_LR11_RL11(FrozenBiMap_LR11_RL11&&) = default;
+    FrozenBiMap_LR11_RL11& operator=(FrozenBiMap_LR11_RL11&&) = default;
+    // spans refer to the owned vectors, a member-wise copy would alias the source
+    FrozenBiMap_LR11_RL11(FrozenBiMap_LR11_RL11 const&) = delete;
+    FrozenBiMap_LR11_RL11& operator=(FrozenBiMap_LR11_RL11 const&) = delete;
+
+    // both maps of a BiMap_LR11_RL11 are already sorted, no re-sort needed; their comparators are kept
+    template <typename ALLOC>
+    static FrozenBiMap_LR11_RL11 freeze(const BiMap_LR11_RL11<LEFTT, RIGHT, LCMP, RCMP, ALLOC>& biMap)
+    {
+      FrozenBiMap_LR11_RL11 frozen{biMap.getLefttMap().key_comp(), biMap.getRightMap().key_comp()};
+      frozen._reserve(biMap.size_left());
+      for(const auto& [lefttKey, rightKey] : biMap.getLefttMap())
+      {
+        frozen._lefttKeysOwned.push_back(lefttKey);
+        frozen._lefttValuesOwned.push_back(rightKey);
+      }
+      for(const auto& [rightKey, lefttKey] : biMap.getRightMap())
+      {
+        frozen._rightKeysOwned.push_back(rightKey);
+        frozen._rightValuesOwned.push_back(lefttKey);
+      }
+      frozen._attachOwned();
+      return frozen;
+    }
+
+    // returns nullptr if 'lefttKey' is absent
+    inline const RIGHT* find_left(const LEFTT& lefttKey) const
+    {
+      const size_t idx = branchlessLowerBound(_lefttKeys, lefttKey, _lefttKeyLessCompare);
+      if(idx == _lefttKeys.size() || _lefttKeyLessCompare(lefttKey, _lefttKeys[idx]))
+        return nullptr;
+      return &_lefttValues[idx];
+    }
+
+    // returns nullptr if 'rightKey' is absent
+    inline const LEFTT* find_right(const RIGHT& rightKey) const
+    {
+      const size_t idx = branchlessLowerBound(_rightKeys, rightKey, _rightKeyLessCompare);
+      if(idx == _rightKeys.size() || _rightKeyLessCompare(rightKey, _rightKeys[idx]))
+        return nullptr;
+      return &_rightValues[idx];
+    }
+
+    inline size_t size_left () const { return _lefttKeys.size(); }
+    inline size_t size_right() const { return _rightKeys.size(); }
+
+    inline bool isView() const { return _lefttKeys.data() != _lefttKeysOwned.data(); }
+
+    void serialize(std::string& buffer) const
+      requires (std::is_trivially_copyable_v<LEFTT> && std::is_trivially_copyable_v<RIGHT>)
+    {
+      buffer.assign(MAGIC, 8);
+      _FrozenBiMapBuffer::appendU64(buffer, _lefttKeys.size());
+      _FrozenBiMapBuffer::appendU64(buffer, sizeof(LEFTT));
+      _FrozenBiMapBuffer::appendU64(buffer, sizeof(RIGHT));
+      _FrozenBiMapBuffer::appendArray(buffer, _lefttKeys);
+      _FrozenBiMapBuffer::appendArray(buffer, _lefttValues);
+      _FrozenBiMapBuffer::appendArray(buffer, _rightKeys);
+      _FrozenBiMapBuffer::appendArray(buffer, _rightValues);
+    }
+
+    // 'data' ( eg: a memory-mapped file ) has to outlive the view
+    static FrozenBiMap_LR11_RL11 view(const void* data, size_t size,
+                                      const LCMP& lefttKeyLessCompare = LCMP{}, const RCMP& rightKeyLessCompare = RCMP{})
+      requires (std::is_trivially_copyable_v<LEFTT> && std::is_trivially_copyable_v<RIGHT>)
+    {
+      const char* bytes = static_cast<const char*>(data);
+      _FrozenBiMapBuffer::checkHeader(bytes, size, MAGIC);
+      size_t offset = 8;
+      const uint64_t count = _FrozenBiMapBuffer::readU64(bytes, size, offset);
+      if(_FrozenBiMapBuffer::readU64(bytes, size, offset) != sizeof(LEFTT) ||
+         _FrozenBiMapBuffer::readU64(bytes, size, offset) != sizeof(RIGHT))
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap_LR11_RL11::view() : element size mismatch");
+      }
+      FrozenBiMap_LR11_RL11 frozen{lefttKeyLessCompare, rightKeyLessCompare};
+      frozen._lefttKeys   = _FrozenBiMapBuffer::readArray<LEFTT>(bytes, size, offset, count);
+      frozen._lefttValues = _FrozenBiMapBuffer::readArray<RIGHT>(bytes, size, offset, count);
+      frozen._rightKeys   = _FrozenBiMapBuffer::readArray<RIGHT>(bytes, size, offset, count);
+      frozen._rightValues = _FrozenBiMapBuffer::readArray<LEFTT>(bytes, size, offset, count);
+      return frozen;
+    }
+
+  private:
+    std::vector<LEFTT>  _lefttKeysOwned;
+    std::vector<RIGHT>  _lefttValuesOwned;
+    std::vector<RIGHT>  _rightKeysOwned;
+    std::vector<LEFTT>  _rightValuesOwned;
+
+    std::span<const LEFTT>  _lefttKeys;
+    std::span<const RIGHT>  _lefttValues;
+    std::span<const RIGHT>  _rightKeys;
+    std::span<const LEFTT>  _rightValues;
+
+    LCMP  _lefttKeyLessCompare;
+    RCMP  _rightKeyLessCompare;
+
+    FrozenBiMap_LR11_RL11(const LCMP& lefttKeyLessCompare, const RCMP& rightKeyLessCompare)
+      : _lefttKeysOwned(), _lefttValuesOwned(), _rightKeysOwned(), _rightValuesOwned(),
+        _lefttKeys(), _lefttValues(), _rightKeys(), _rightValues(),
+        _lefttKeyLessCompare(lefttKeyLessCompare), _rightKeyLessCompare(rightKeyLessCompare)
+    {}
+
+    void _reserve(size_t count)
+    {
+      _lefttKeysOwned.reserve(count);
+      _lefttValuesOwned.reserve(count);
+      _rightKeysOwned.reserve(count);
+      _rightValuesOwned.reserve(count);
+    }
+
+    void _attachOwned()
+    {
+      _lefttKeys   = _lefttKeysOwned;
+      _lefttValues = _lefttValuesOwned;
+      _rightKeys   = _rightKeysOwned;
+      _rightValues = _rightValuesOwned;
+    }
+  };
+
+
+  /*
+   * Read-only BiMap_LR1M_RL11 :
+   *   left  -> sorted left-keys, with CSR offsets into the right-values grouped per left-key
+   *   right -> sorted right-keys and their left-key
+   */
+  template < typename LEFTT, typename RIGHT,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+  class FrozenBiMap_LR1M_RL11
+  {
+  public:
+    static constexpr char MAGIC[9] = "DSFBM01M";
+
+    // 'lefttRightPairs' in any order; throws if a right-key repeats
+    explicit FrozenBiMap_LR1M_RL11(std::vector<std::pair<LEFTT, RIGHT>> lefttRightPairs,
+                                   const LCMP& lefttKeyLessCompare = LCMP{}, const RCMP& rightKeyLessCompare = RCMP{})
+      : FrozenBiMap_LR1M_RL11(lefttKeyLessCompare, rightKeyLessCompare)
+    {
+      std::sort(lefttRightPairs.begin(), lefttRightPairs.end(),
+                [this](const auto& lhs, const auto& rhs)
+                {
+                  if(_lefttKeyLessCompare(lhs.first, rhs.first)) return true;
+                  if(_lefttKeyLessCompare(rhs.first, lhs.first)) return false;
+                  return _rightKeyLessCompare(lhs.second, rhs.second);
+                });
+      for(size_t iii = 0; iii < lefttRightPairs.size(); ++iii)
+      {
+        if(iii == 0 || _lefttKeyLessCompare(lefttRightPairs[iii-1].first, lefttRightPairs[iii].first))
+        {
+          _lefttKeysOwned.push_back(lefttRightPairs[iii].first);
+          _rightOffsetsOwned.push_back(iii);
+        }
+        _lefttRightsOwned.push_back(lefttRightPairs[iii].second);
+      }
+      _rightOffsetsOwned.push_back(lefttRightPairs.size());
+
+      std::sort(lefttRightPairs.begin(), lefttRightPairs.end(),
+                [this](const auto& lhs, const auto& rhs) { return _rightKeyLessCompare(lhs.second, rhs.second); });
+      for(size_t iii = 0; iii < lefttRightPairs.size(); ++iii)
+      {
+        if(iii > 0 && !_rightKeyLessCompare(lefttRightPairs[iii-1].second, lefttRightPairs[iii].second))
+        {
+          throw std::invalid_argument("ERROR : FrozenBiMap_LR1M_RL11() : duplicate right-key");
+        }
+        _rightKeysOwned.push_back(lefttRightPairs[iii].second);
+        _rightValuesOwned.push_back(lefttRightPairs[iii].first);
+      }
+      _attachOwned();
+    }
+
+    FrozenBiMap_LR1M_RL11(FrozenBiMap_LR1M_RL11&&) = default;
+    FrozenBiMap_LR1M_RL11& operator=(FrozenBiMap_LR1M_RL11&&) = default;
+    // spans refer to the owned vectors, a member-wise copy would alias the source
+    FrozenBiMap_LR1M_RL11(FrozenBiMap_LR1M_RL11 const&) = delete;
+    FrozenBiMap_LR1M_RL11& operator=(FrozenBiMap_LR1M_RL11 const&) = delete;
+
+    // the comparators of 'biMap' are kept, the arrays are laid out in its order
+    template <typename RSET, typename ALLOC>
+    static FrozenBiMap_LR1M_RL11 freeze(const BiMap_LR1M_RL11<LEFTT, RIGHT, LCMP, RCMP, RSET, ALLOC>& biMap)
+    {
+      FrozenBiMap_LR1M_RL11 frozen{biMap.getLefttMap().key_comp(), biMap.getRightMap().key_comp()};
+      frozen._lefttKeysOwned.reserve(biMap.size_left());
+      frozen._rightOffsetsOwned.reserve(biMap.size_left() + 1);
+      frozen._lefttRightsOwned.reserve(biMap.size_right());
+      for(const auto& [lefttKey, rightKeys] : biMap.getLefttMap())
+      {
+        frozen._lefttKeysOwned.push_back(lefttKey);
+        frozen._rightOffsetsOwned.push_back(frozen._lefttRightsOwned.size());
+        const auto groupBegin = frozen._lefttRightsOwned.insert(frozen._lefttRightsOwned.end(), rightKeys.begin(), rightKeys.end());
+        // an RSET is built with its own ( default ) comparator, which need not order as the right-map does
+        if(!std::is_sorted(groupBegin, frozen._lefttRightsOwned.end(), frozen._rightKeyLessCompare))
+          std::sort(groupBegin, frozen._lefttRightsOwned.end(), frozen._rightKeyLessCompare);
+      }
+      frozen._rightOffsetsOwned.push_back(frozen._lefttRightsOwned.size());
+
+      frozen._rightKeysOwned.reserve(biMap.size_right());
+      frozen._rightValuesOwned.reserve(biMap.size_right());
+      for(const auto& [rightKey, lefttKey] : biMap.getRightMap())
+      {
+        frozen._rightKeysOwned.push_back(rightKey);
+        frozen._rightValuesOwned.push_back(lefttKey);
+      }
+      frozen._attachOwned();
+      return frozen;
+    }
+
+    // sorted right-keys of 'lefttKey'; empty if 'lefttKey' is absent
+    inline std::span<const RIGHT> find_left(const LEFTT& lefttKey) const
+    {
+      const size_t idx = branchlessLowerBound(_lefttKeys, lefttKey, _lefttKeyLessCompare);
+      if(idx == _lefttKeys.size() || _lefttKeyLessCompare(lefttKey, _lefttKeys[idx]))
+        return {};
+      return _lefttRights.subspan(static_cast<size_t>(_rightOffsets[idx]),
+                                  static_cast<size_t>(_rightOffsets[idx + 1] - _rightOffsets[idx]));
+    }
+
+    // returns nullptr if 'rightKey' is absent
+    inline const LEFTT* find_right(const RIGHT& rightKey) const
+    {
+      const size_t idx = branchlessLowerBound(_rightKeys, rightKey, _rightKeyLessCompare);
+      if(idx == _rightKeys.size() || _rightKeyLessCompare(rightKey, _rightKeys[idx]))
+        return nullptr;
+      return &_rightValues[idx];
+    }
+
+    inline bool contains_left(const LEFTT& lefttKey, const RIGHT& rightKey) const
+    {
+      const std::span<const RIGHT> rightKeys = find_left(lefttKey);
+      const size_t idx = branchlessLowerBound(rightKeys, rightKey, _rightKeyLessCompare);
+      return idx != rightKeys.size() && !_rightKeyLessCompare(rightKey, rightKeys[idx]);
+    }
+
+    inline bool contains_right(const RIGHT& rightKey, const LEFTT& lefttKey) const
+    {
+      const LEFTT* existingLefttKey = find_right(rightKey);
+      return existingLefttKey != nullptr &&
+             !_lefttKeyLessCompare(*existingLefttKey, lefttKey) &&
+             !_lefttKeyLessCompare(lefttKey, *existingLefttKey);
+    }
+
+    inline size_t size_left () const { return _lefttKeys.size(); }
+    inline size_t size_right() const { return _rightKeys.size(); }
+
+    inline bool isView() const { return _lefttKeys.data() != _lefttKeysOwned.data(); }
+
+    void serialize(std::string& buffer) const
+      requires (std::is_trivially_copyable_v<LEFTT> && std::is_trivially_copyable_v<RIGHT>)
+    {
+      buffer.assign(MAGIC, 8);
+      _FrozenBiMapBuffer::appendU64(buffer, _lefttKeys.size());
+      _FrozenBiMapBuffer::appendU64(buffer, _rightKeys.size());
+      _FrozenBiMapBuffer::appendU64(buffer, sizeof(LEFTT));
+      _FrozenBiMapBuffer::appendU64(buffer, sizeof(RIGHT));
+      _FrozenBiMapBuffer::appendArray(buffer, _lefttKeys);
+      _FrozenBiMapBuffer::appendArray(buffer, _rightOffsets);
+      _FrozenBiMapBuffer::appendArray(buffer, _lefttRights);
+      _FrozenBiMapBuffer::appendArray(buffer, _rightKeys);
+      _FrozenBiMapBuffer::appendArray(buffer, _rightValues);
+    }
+
+    // 'data' ( eg: a memory-mapped file ) has to outlive the view
+    static FrozenBiMap_LR1M_RL11 view(const void* data, size_t size,
+                                      const LCMP& lefttKeyLessCompare = LCMP{}, const RCMP& rightKeyLessCompare = RCMP{})
+      requires (std::is_trivially_copyable_v<LEFTT> && std::is_trivially_copyable_v<RIGHT>)
+    {
+      const char* bytes = static_cast<const char*>(data);
+      _FrozenBiMapBuffer::checkHeader(bytes, size, MAGIC);
+      size_t offset = 8;
+      const uint64_t lefttCount = _FrozenBiMapBuffer::readU64(bytes, size, offset);
+      const uint64_t rightCount = _FrozenBiMapBuffer::readU64(bytes, size, offset);
+      if(_FrozenBiMapBuffer::readU64(bytes, size, offset) != sizeof(LEFTT) ||
+         _FrozenBiMapBuffer::readU64(bytes, size, offset) != sizeof(RIGHT))
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap_LR1M_RL11::view() : element size mismatch");
+      }
+      FrozenBiMap_LR1M_RL11 frozen{lefttKeyLessCompare, rightKeyLessCompare};
+      frozen._lefttKeys    = _FrozenBiMapBuffer::readArray<LEFTT>(bytes, size, offset, lefttCount);
+      frozen._rightOffsets = _FrozenBiMapBuffer::readArray<uint64_t>(bytes, size, offset, lefttCount + 1);
+      frozen._lefttRights  = _FrozenBiMapBuffer::readArray<RIGHT>(bytes, size, offset, rightCount);
+      frozen._rightKeys    = _FrozenBiMapBuffer::readArray<RIGHT>(bytes, size, offset, rightCount);
+      frozen._rightValues  = _FrozenBiMapBuffer::readArray<LEFTT>(bytes, size, offset, rightCount);
+      if(frozen._rightOffsets.front() != 0 || frozen._rightOffsets.back() != rightCount ||
+         !std::is_sorted(frozen._rightOffsets.begin(), frozen._rightOffsets.end()))
+      {
+        throw std::invalid_argument("ERROR : FrozenBiMap_LR1M_RL11::view() : corrupt offsets");
+      }
+      return frozen;
+    }
+
+  private:
+    std::vector<LEFTT>     _lefttKeysOwned;
+    std::vector<uint64_t>  _rightOffsetsOwned;
+    std::vector<RIGHT>     _lefttRightsOwned;
+    std::vector<RIGHT>     _rightKeysOwned;
+    std::vector<LEFTT>     _rightValuesOwned;
+
+    std::span<const LEFTT>     _lefttKeys;
+    std::span<const uint64_t>  _rightOffsets;   // size_left()+1 entries
+    std::span<const RIGHT>     _lefttRights;
+    std::span<const RIGHT>     _rightKeys;
+    std::span<const LEFTT>     _rightValues;
+
+    LCMP  _lefttKeyLessCompare;
+    RCMP  _rightKeyLessCompare;
+
+    FrozenBiMap_LR1M_RL11(const LCMP& lefttKeyLessCompare, const RCMP& rightKeyLessCompare)
+      : _lefttKeysOwned(), _rightOffsetsOwned(), _lefttRightsOwned(), _rightKeysOwned(), _rightValuesOwned(),
+        _lefttKeys(), _rightOffsets(), _lefttRights(), _rightKeys(), _rightValues(),
+        _lefttKeyLessCompare(lefttKeyLessCompare), _rightKeyLessCompare(rightKeyLessCompare)
+    {}
+
+    void _attachOwned()
+    {
+      _lefttKeys    = _lefttKeysOwned;
+      _rightOffsets = _rightOffsetsOwned;
+      _lefttRights  = _lefttRightsOwned;
+      _rightKeys    = _rightKeysOwned;
+      _rightValues  = _rightValuesOwned;
+    }
+  };
+
+} }   //  namespace datastructure::bimap
@@ -0,0 +1,348 @@
+/*
+ * ManyToManyBiMap.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+#include <biMap/FrozenBiMap.h>
+
+
+namespace datastructure { namespace bimap
+{
+  /*
+   * Read-only many-to-many relation, eg: index <-> constituent securities.
+   *
+   * Each distinct key is stored once, in a sorted key array per side. Both directions are
+   * compressed-sparse-row : offsets[i] .. offsets[i+1] delimit the neighbours of key i in a
+   * single array of indices into the other side's keys. The neighbours of a key are therefore
+   * contiguous, and sorted since the key arrays are sorted.
+   *
+   * Built through BiMap_LRMM_RLMM::Builder; toBuilder() goes back to a mutable form for edits.
+   */
+  template < typename LEFTT, typename RIGHT,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+  class BiMap_LRMM_RLMM
+  {
+  public:
+    using t_index = uint32_t;
+
+    // neighbours of a key : a contiguous run of indices, dereferenced into the other side's keys
+    template <typename KEY>
+    class NeighbourRange
+    {
+    public:
+      class const_iterator
+      {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = KEY;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const KEY*;
+        using reference         = const KEY&;
+
+        const_iterator() : _index(nullptr), _keys(nullptr) {}
+        const_iterator(const t_index* index, const KEY* keys) : _index(index), _keys(keys) {}
+
+        inline reference operator*()  const { return _keys[*_index]; }
+        inline pointer   operator->() const { return &_keys[*_index]; }
+        inline reference operator[](difference_type offset) const { return _keys[_index[offset]]; }
+
+        inline const_iterator& operator++() { ++_index; return *this; }
+        inline const_iterator& operator--() { --_index; return *this; }
+        inline const_iterator  operator++(int) { const_iterator prev{*this}; ++_index; return prev; }
+        inline const_iterator  operator--(int) { const_iterator prev{*this}; --_index; return prev; }
+        inline const_iterator& operator+=(difference_type offset) { _index += offset; return *this; }
+        inline const_iterator& operator-=(difference_type offset) { _index -= offset; return *this; }
+        inline const_iterator  operator+(difference_type offset) const { return const_iterator(_index + offset, _keys); }
+        inline const_iterator  operator-(difference_type offset) const { return const_iterator(_index - offset, _keys); }
+        friend inline const_iterator operator+(difference_type offset, const const_iterator& iter) { return iter + offset; }
+        inline difference_type operator-(const const_iterator& other) const { return _index - other._index; }
+
+        inline bool operator==(const const_iterator& other) const { return _index == other._index; }
+        inline auto operator<=>(const const_iterator& other) const { return _index <=> other._index; }
+
+      private:
+        const t_index*  _index;
+        const KEY*      _keys;
+      };
+
+      NeighbourRange() : _indices(), _keys() {}
+      NeighbourRange(std::span<const t_index> indices, std::span<const KEY> keys) : _indices(indices), _keys(keys) {}
+
+      inline const_iterator begin() const { return const_iterator(_indices.data(), _keys.data()); }
+      inline const_iterator end()   const { return const_iterator(_indices.data() + _indices.size(), _keys.data()); }
+      inline size_t size()  const { return _indices.size(); }
+      inline bool   empty() const { return _indices.empty(); }
+      inline const KEY& operator[](size_t idx) const { return _keys[_indices[idx]]; }
+
+      // positions into the other side's key array, eg: to index per-key attributes kept alongside
+      inline std::span<const t_index> indices() const { return _indices; }
+
+    private:
+      std::span<const t_index>  _indices;
+      std::span<const KEY>      _keys;
+    };
+
+    /*
+     * mutable form : collects (LEFTT, RIGHT) pairs in any order, duplicates allowed.
+     * build() sorts, de-duplicates and packs them. insert() and erase() of the same pair are
+     * applied in call order, the last one wins : erase() then insert() keeps the pair.
+     */
+    class Builder
+    {
+    public:
+      Builder(const LCMP& lefttKeyLessCompare = LCMP{}, const RCMP& rightKeyLessCompare = RCMP{})
+        : _pendingPairs(),
+          _erasedCount(0),
+          _lefttKeyLessCompare(lefttKeyLessCompare),
+          _rightKeyLessCompare(rightKeyLessCompare)
+      {}
+
+      inline void insert(const LEFTT& lefttKey, const RIGHT& rightKey)
+      {
+        _pendingPairs.push_back(t_pendingPair{{lefttKey, rightKey}, false});
+      }
+
+      inline void erase(const LEFTT& lefttKey, const RIGHT& rightKey)
+      {
+        _pendingPairs.push_back(t_pendingPair{{lefttKey, rightKey}, true});
+        ++_erasedCount;
+      }
+
+      inline void reserve(size_t pairCount) { _pendingPairs.reserve(pairCount); }
+
+      BiMap_LRMM_RLMM build() &&
+      {
+        const auto pairLess = [this](const t_pendingPair& lhs, const t_pendingPair& rhs)
+                              {
+                                if(_lefttKeyLessCompare(lhs.lefttRightPair.first, rhs.lefttRightPair.first)) return true;
+                                if(_lefttKeyLessCompare(rhs.lefttRightPair.first, lhs.lefttRightPair.first)) return false;
+                                return _rightKeyLessCompare(lhs.lefttRightPair.second, rhs.lefttRightPair.second);
+                              };
+        // with erasures the call order of a pair's operations matters, hence the stable sort
+        if(_erasedCount == 0)
+          std::sort(_pendingPairs.begin(), _pendingPairs.end(), pairLess);
+        else
+          std::stable_sort(_pendingPairs.begin(), _pendingPairs.end(), pairLess);
+
+        std::vector<std::pair<LEFTT, RIGHT>> lefttRightPairs;
+        lefttRightPairs.reserve(_pendingPairs.size() - _erasedCount);
+        for(auto runBegin = _pendingPairs.begin(); runBegin != _pendingPairs.end(); )
+        {
+          auto runLast = runBegin;
+          while(std::next(runLast) != _pendingPairs.end() && !pairLess(*runLast, *std::next(runLast)))
+            ++runLast;
+          if(!runLast->isErased)
+            lefttRightPairs.push_back(std::move(runLast->lefttRightPair));
+          runBegin = std::next(runLast);
+        }
+        _pendingPairs.clear();
+        _erasedCount = 0;
+        return BiMap_LRMM_RLMM(lefttRightPairs, _lefttKeyLessCompare, _rightKeyLessCompare);
+      }
+
+    private:
+      struct t_pendingPair
+      {
+        std::pair<LEFTT, RIGHT>  lefttRightPair;
+        bool                     isErased;
+      };
+
+      std::vector<t_pendingPair>  _pendingPairs;   // in call order until build()
+      size_t                      _erasedCount;
+      LCMP                        _lefttKeyLessCompare;
+      RCMP                        _rightKeyLessCompare;
+    };
+
+    BiMap_LRMM_RLMM(BiMap_LRMM_RLMM&&) = default;
+    BiMap_LRMM_RLMM& operator=(BiMap_LRMM_RLMM&&) = default;
+    BiMap_LRMM_RLMM(BiMap_LRMM_RLMM const&) = default;
+    BiMap_LRMM_RLMM& operator=(BiMap_LRMM_RLMM const&) = default;
+
+    // every pair, as a Builder to edit and build() again
+    Builder toBuilder() const
+    {
+      Builder builder(_lefttKeyLessCompare, _rightKeyLessCompare);
+      builder.reserve(_lefttNeighbours.size());
+      for(size_t lefttIdx = 0; lefttIdx < _lefttKeys.size(); ++lefttIdx)
+      {
+        for(const RIGHT& rightKey : _neighboursOfLeftt(lefttIdx))
+        {
+          builder.insert(_lefttKeys[lefttIdx], rightKey);
+        }
+      }
+      return builder;
+    }
+
+    // right-keys related to 'lefttKey', ascending; empty if 'lefttKey' is absent
+    inline NeighbourRange<RIGHT> find_left(const LEFTT& lefttKey) const
+    {
+      const size_t lefttIdx = branchlessLowerBound(std::span<const LEFTT>(_lefttKeys), lefttKey, _lefttKeyLessCompare);
+      if(lefttIdx == _lefttKeys.size() || _lefttKeyLessCompare(lefttKey, _lefttKeys[lefttIdx]))
+        return {};
+      return _neighboursOfLeftt(lefttIdx);
+    }
+
+    // left-keys related to 'rightKey', ascending; empty if 'rightKey' is absent
+    inline NeighbourRange<LEFTT> find_right(const RIGHT& rightKey) const
+    {
+      const size_t rightIdx = branchlessLowerBound(std::span<const RIGHT>(_rightKeys), rightKey, _rightKeyLessCompare);
+      if(rightIdx == _rightKeys.size() || _rightKeyLessCompare(rightKey, _rightKeys[rightIdx]))
+        return {};
+      return _neighboursOfRight(rightIdx);
+    }
+
+    inline bool contains(const LEFTT& lefttKey, const RIGHT& rightKey) const
+    {
+      const NeighbourRange<RIGHT> rightKeys = find_left(lefttKey);
+      auto rightIter = std::lower_bound(rightKeys.begin(), rightKeys.end(), rightKey, _rightKeyLessCompare);
+      return rightIter != rightKeys.end() && !_rightKeyLessCompare(rightKey, *rightIter);
+    }
+
+    // neighbours of the key at a position of lefttKeys() / rightKeys(), for full scans without lookups
+    inline NeighbourRange<RIGHT> neighbours_left (size_t lefttIdx) const { return _neighboursOfLeftt(lefttIdx); }
+    inline NeighbourRange<LEFTT> neighbours_right(size_t rightIdx) const { return _neighboursOfRight(rightIdx); }
+
+    inline std::span<const LEFTT> lefttKeys() const { return _lefttKeys; }
+    inline std::span<const RIGHT> rightKeys() const { return _rightKeys; }
+
+    inline size_t size_left () const { return _lefttKeys.size(); }
+    inline size_t size_right() const { return _rightKeys.size(); }
+    inline size_t size_pairs() const { return _lefttNeighbours.size(); }
+
+    // bytes in use : the object, the key and index arrays, and what the keys own
+    size_t memory_usage() const
+    {
+      size_t usedBytes = sizeof(*this) +
+                         _lefttKeys.capacity() * sizeof(LEFTT) + _rightKeys.capacity() * sizeof(RIGHT) +
+                         ( _lefttOffsets.capacity() + _lefttNeighbours.capacity() +
+                           _rightOffsets.capacity() + _rightNeighbours.capacity() ) * sizeof(t_index);
+      for(const LEFTT& lefttKey : _lefttKeys)
+      {
+        usedBytes += _ownedHeapBytes(lefttKey);
+      }
+      for(const RIGHT& rightKey : _rightKeys)
+      {
+        usedBytes += _ownedHeapBytes(rightKey);
+      }
+      return usedBytes;
+    }
+
+  private:
+    std::vector<LEFTT>    _lefttKeys;
+    std::vector<t_index>  _lefttOffsets;      // size_left()+1 entries
+    std::vector<t_index>  _lefttNeighbours;   // indices into _rightKeys
+    std::vector<RIGHT>    _rightKeys;
+    std::vector<t_index>  _rightOffsets;      // size_right()+1 entries
+    std::vector<t_index>  _rightNeighbours;   // indices into _lefttKeys
+    LCMP                  _lefttKeyLessCompare;
+    RCMP                  _rightKeyLessCompare;
+
+    // 'lefttRightPairs' sorted on (LEFTT, RIGHT) and unique
+    BiMap_LRMM_RLMM(const std::vector<std::pair<LEFTT, RIGHT>>& lefttRightPairs,
+                    const LCMP& lefttKeyLessCompare, const RCMP& rightKeyLessCompare)
+      : _lefttKeys(),
+        _lefttOffsets(),
+        _lefttNeighbours(),
+        _rightKeys(),
+        _rightOffsets(),
+        _rightNeighbours(),
+        _lefttKeyLessCompare(lefttKeyLessCompare),
+        _rightKeyLessCompare(rightKeyLessCompare)
+    {
+      if(lefttRightPairs.size() > std::numeric_limits<t_index>::max())
+      {
+        throw std::invalid_argument("ERROR : BiMap_LRMM_RLMM::Builder::build() : more pairs than a 32 bit index can address");
+      }
+
+      // one sort of the pair positions on the right-key gives both the unique right-keys and
+      // the right index of every pair
+      std::vector<t_index> rightOrder(lefttRightPairs.size());
+      for(size_t pairIdx = 0; pairIdx < rightOrder.size(); ++pairIdx)
+      {
+        rightOrder[pairIdx] = static_cast<t_index>(pairIdx);
+      }
+      std::sort(rightOrder.begin(), rightOrder.end(),
+                [this, &lefttRightPairs](t_index lhs, t_index rhs) { return _rightKeyLessCompare(lefttRightPairs[lhs].second, lefttRightPairs[rhs].second); });
+      _lefttNeighbours.resize(lefttRightPairs.size());
+      std::vector<t_index> rightDegree;
+      for(const t_index pairIdx : rightOrder)
+      {
+        const RIGHT& rightKey = lefttRightPairs[pairIdx].second;
+        if(_rightKeys.empty() || _rightKeyLessCompare(_rightKeys.back(), rightKey))
+        {
+          _rightKeys.push_back(rightKey);
+          rightDegree.push_back(0);
+        }
+        _lefttNeighbours[pairIdx] = static_cast<t_index>(_rightKeys.size() - 1);
+        ++rightDegree.back();
+      }
+      _rightKeys.shrink_to_fit();
+
+      // left CSR : pairs are grouped by left-key already
+      for(size_t pairIdx = 0; pairIdx < lefttRightPairs.size(); ++pairIdx)
+      {
+        const LEFTT& lefttKey = lefttRightPairs[pairIdx].first;
+        if(_lefttKeys.empty() || _lefttKeyLessCompare(_lefttKeys.back(), lefttKey))
+        {
+          _lefttKeys.push_back(lefttKey);
+          _lefttOffsets.push_back(static_cast<t_index>(pairIdx));
+        }
+      }
+      _lefttOffsets.push_back(static_cast<t_index>(lefttRightPairs.size()));
+      _lefttKeys.shrink_to_fit();
+      _lefttOffsets.shrink_to_fit();
+
+      // right CSR : counting sort of the same pairs on the right index, left indices stay ascending
+      _rightOffsets.resize(_rightKeys.size() + 1, 0);
+      for(size_t rightIdx = 0; rightIdx < _rightKeys.size(); ++rightIdx)
+      {
+        _rightOffsets[rightIdx + 1] = _rightOffsets[rightIdx] + rightDegree[rightIdx];
+      }
+      std::vector<t_index> rightFill(_rightOffsets.begin(), _rightOffsets.end() - 1);
+      _rightNeighbours.resize(_lefttNeighbours.size());
+      for(size_t lefttIdx = 0; lefttIdx < _lefttKeys.size(); ++lefttIdx)
+      {
+        for(t_index pairIdx = _lefttOffsets[lefttIdx]; pairIdx < _lefttOffsets[lefttIdx + 1]; ++pairIdx)
+        {
+          _rightNeighbours[rightFill[_lefttNeighbours[pairIdx]]++] = static_cast<t_index>(lefttIdx);
+        }
+      }
+    }
+
+    inline NeighbourRange<RIGHT> _neighboursOfLeftt(size_t lefttIdx) const
+    {
+      return NeighbourRange<RIGHT>(std::span<const t_index>(_lefttNeighbours).subspan(_lefttOffsets[lefttIdx],
+                                                                                      _lefttOffsets[lefttIdx + 1] - _lefttOffsets[lefttIdx]),
+                                   _rightKeys);
+    }
+
+    inline NeighbourRange<LEFTT> _neighboursOfRight(size_t rightIdx) const
+    {
+      return NeighbourRange<LEFTT>(std::span<const t_index>(_rightNeighbours).subspan(_rightOffsets[rightIdx],
+                                                                                      _rightOffsets[rightIdx + 1] - _rightOffsets[rightIdx]),
+                                   _lefttKeys);
+    }
+  };
+
+} }   //  namespace datastructure::bimap
@@ -0,0 +1,255 @@
+/*
+ * SmallSortedSet.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+
+#include <new>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include <biMap/BiMap.h>
+
+
+namespace datastructure { namespace bimap
+{
+  /*
+   * Sorted set of unique keys in a contiguous array : the first N keys live inside the object,
+   * beyond that the array spills to the heap (doubling capacity).
+   * Meant for the many-side of BiMap_LR1M_RL11 when most left-keys hold a handful of right-keys;
+   * a std::set costs a tree header plus one node allocation per key.
+   * Lookup is a binary search, insert/erase shift the tail, iteration walks a plain array.
+   * Iterators are invalidated by insert and erase. Holds at most 2^32-1 keys.
+   */
+  template <typename T, size_t N, typename CMP = std::less<T>>
+  class SmallSortedSet
+  {
+    static_assert(N > 0 && N <= UINT32_MAX, "SmallSortedSet : inline capacity N must be in [1, 2^32-1]");
+
+  public:
+    using value_type     = T;
+    using key_compare    = CMP;
+    using size_type      = size_t;
+    using iterator       = const T*;   // keys are immutable, as in std::set
+    using const_iterator = const T*;
+
+    explicit SmallSortedSet(const CMP& keyLessCompare = CMP{})
+      : _inlineBuffer(),
+        _data(_inlineData()),
+        _size(0),
+        _capacity(static_cast<uint32_t>(N)),
+        _keyLessCompare(keyLessCompare)
+    {}
+
+    SmallSortedSet(SmallSortedSet const& other)
+      : SmallSortedSet(other._keyLessCompare)
+    {
+      if(other._size > N)
+      {
+        _grow(other._size);
+      }
+      std::uninitialized_copy(other.begin(), other.end(), _data);
+      _size = other._size;
+    }
+
+    SmallSortedSet(SmallSortedSet&& other) noexcept
+      : SmallSortedSet(other._keyLessCompare)
+    {
+      _takeFrom(std::move(other));
+    }
+
+    SmallSortedSet& operator=(SmallSortedSet const& other)
+    {
+      if(this != &other)
+      {
+        SmallSortedSet copy(other);
+        *this = std::move(copy);
+      }
+      return *this;
+    }
+
+    SmallSortedSet& operator=(SmallSortedSet&& other) noexcept
+    {
+      if(this != &other)
+      {
+        _release();
+        _takeFrom(std::move(other));
+      }
+      return *this;
+    }
+
+    ~SmallSortedSet()
+    {
+      _release();
+    }
+
+    bool operator==(SmallSortedSet const& other) const
+    {
+      return std::equal(begin(), end(), other.begin(), other.end(),
+                        [this](const T& lhs, const T& rhs) { return !_keyLessCompare(lhs, rhs) && !_keyLessCompare(rhs, lhs); });
+    }
+
+    inline std::pair<iterator, bool> emplace(const T& key)
+    {
+      T* position = _lowerBound(key);
+      if(position != _data + _size && !_keyLessCompare(key, *position))
+      {
+        return { position, false };
+      }
+
+      const size_t insertIdx = static_cast<size_t>(position - _data);
+      if(_size == _capacity)
+      {
+        _grow(2 * static_cast<size_t>(_capacity));
+      }
+      position = _data + insertIdx;
+      if(insertIdx == _size)
+      {
+        ::new (static_cast<void*>(position)) T(key);
+      } else {
+        ::new (static_cast<void*>(_data + _size)) T(std::move(_data[_size - 1]));
+        std::move_backward(position, _data + _size - 1, _data + _size);
+        *position = key;
+      }
+      ++_size;
+      return { position, true };
+    }
+
+    inline std::pair<iterator, bool> insert(const T& key) { return emplace(key); }
+
+    inline iterator erase(const_iterator position)
+    {
+      T* erasePosition = _data + (position - _data);
+      std::move(erasePosition + 1, _data + _size, erasePosition);
+      --_size;
+      std::destroy_at(_data + _size);
+      return erasePosition;
+    }
+
+    inline size_t erase(const T& key)
+    {
+      const_iterator position = find(key);
+      if(position == end())
+        return 0;
+      erase(position);
+      return 1;
+    }
+
+    inline const_iterator find(const T& key) const
+    {
+      const T* position = _lowerBound(key);
+      if(position != _data + _size && !_keyLessCompare(key, *position))
+        return position;
+      return end();
+    }
+
+    inline bool contains(const T& key) const { return find(key) != end(); }
+
+    inline void clear() { _release(); }
+
+    inline const_iterator begin()  const { return _data; }
+    inline const_iterator end()    const { return _data + _size; }
+    inline const_iterator cbegin() const { return _data; }
+    inline const_iterator cend()   const { return _data + _size; }
+
+    inline size_t size()     const { return _size; }
+    inline bool   empty()    const { return _size == 0; }
+    inline size_t capacity() const { return _capacity; }
+    inline bool   isInline() const { return _data == _inlineData(); }
+
+    // bytes in use : the object, a spilled array and what the keys own
+    inline size_t memory_usage() const
+    {
+      size_t usedBytes = sizeof(*this) + (isInline() ? 0 : _capacity * sizeof(T));
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        for(const T& key : *this)
+        {
+          usedBytes += _ownedHeapBytes(key);
+        }
+      }
+      return usedBytes;
+    }
+
+  private:
+    // 32 bit counts and an empty comparator taking no space keep the header at 16 bytes
+    alignas(T) std::byte         _inlineBuffer[N * sizeof(T)];
+    T*                           _data;
+    uint32_t                     _size;
+    uint32_t                     _capacity;
+    [[no_unique_address]] CMP    _keyLessCompare;
+
+    inline T* _inlineData() { return std::launder(reinterpret_cast<T*>(_inlineBuffer)); }
+    inline const T* _inlineData() const { return std::launder(reinterpret_cast<const T*>(_inlineBuffer)); }
+
+    inline T* _lowerBound(const T& key) const
+    {
+      return std::lower_bound(_data, _data + _size, key, _keyLessCompare);
+    }
+
+    void _grow(size_t newCapacity)
+    {
+      T* newData = std::allocator<T>{}.allocate(newCapacity);
+      std::uninitialized_move(_data, _data + _size, newData);
+      std::destroy(_data, _data + _size);
+      if(!isInline())
+      {
+        std::allocator<T>{}.deallocate(_data, _capacity);
+      }
+      _data = newData;
+      _capacity = static_cast<uint32_t>(newCapacity);
+    }
+
+    // destroys the keys and returns to the inline buffer
+    void _release()
+    {
+      std::destroy(_data, _data + _size);
+      if(!isInline())
+      {
+        std::allocator<T>{}.deallocate(_data, _capacity);
+      }
+      _data = _inlineData();
+      _size = 0;
+      _capacity = static_cast<uint32_t>(N);
+    }
+
+    // requires this set to be empty and inline
+    void _takeFrom(SmallSortedSet&& other)
+    {
+      if(other.isInline())
+      {
+        std::uninitialized_move(other._data, other._data + other._size, _data);
+        _size = other._size;
+        other._release();
+      } else {
+        _data = std::exchange(other._data, other._inlineData());
+        _size = std::exchange(other._size, 0);
+        _capacity = std::exchange(other._capacity, static_cast<uint32_t>(N));
+      }
+    }
+  };
+
+  /*
+   * BiMap_LR1M_RL11 with the right-keys of a left-key held in a SmallSortedSet : up to
+   * 'INLINE_RIGHTS' right-keys per left-key need no allocation beyond the left-node.
+   */
+  template < typename LEFTT, typename RIGHT, size_t INLINE_RIGHTS = 3,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+  using SmallSetBiMap_LR1M_RL11 = BiMap_LR1M_RL11<LEFTT, RIGHT, LCMP, RCMP, SmallSortedSet<RIGHT, INLINE_RIGHTS, RCMP>>;
+
+} }   //  namespace datastructure::bimap
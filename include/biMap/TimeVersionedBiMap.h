@@ -0,0 +1,256 @@
+/*
+ * TimeVersionedBiMap.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+
+#include <map>
+#include <span>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+
+namespace datastructure { namespace bimap
+{
+  /*
+   * A (LEFTT <-> RIGHT) one-to-one mapping that changes over time, eg: symbol <-> ISIN where
+   * symbols get renamed and later reused by a different company.
+   *
+   * Each mapping is held for a half-open date interval [fromDate, untilDate); an empty untilDate
+   * means 'still valid'. For a given date every left-key maps to at most one right-key and
+   * vice versa. Per key the intervals are kept in a sorted vector, and back-to-back intervals
+   * of the same pair are coalesced, so an as-of lookup is a map lookup plus a binary search.
+   */
+  template < typename LEFTT, typename RIGHT, typename DATE,
+             typename LCMP = std::less<LEFTT>, typename RCMP = std::less<RIGHT> >
+  class TimeVersionedBiMap
+  {
+  public:
+    template <typename OTHER>
+    struct Interval
+    {
+      DATE                 fromDate;
+      std::optional<DATE>  untilDate;   // exclusive, std::nullopt -> open ended
+      OTHER                other;
+
+      inline bool contains(const DATE& forDate) const
+      {
+        return !(forDate < fromDate) && (!untilDate.has_value() || forDate < untilDate.value());
+      }
+    };
+
+    using t_lefttInterval = Interval<RIGHT>;   // interval of a left-key, holds the right-key
+    using t_rightInterval = Interval<LEFTT>;   // interval of a right-key, holds the left-key
+
+  private:
+    /*
+     * one direction of the bimap : KEY -> timeline of OTHER
+     */
+    template <typename KEY, typename OTHER, typename KCMP, typename OCMP>
+    class _Timelines
+    {
+    public:
+      using t_interval = Interval<OTHER>;
+      using t_timeline = std::vector<t_interval>;   // ascending fromDate, non-overlapping
+
+      _Timelines(const KCMP& keyLessCompare, const OCMP& otherLessCompare)
+        : _timelines(keyLessCompare),
+          _otherLessCompare(otherLessCompare)
+      {}
+
+      inline const OTHER* find(const KEY& key, const DATE& asOfDate) const
+      {
+        auto timelineIter = _timelines.find(key);
+        if(timelineIter == _timelines.end())
+          return nullptr;
+
+        const t_timeline& timeline = timelineIter->second;
+        // first interval starting after 'asOfDate', the candidate is the one before it
+        auto intervalIter = std::upper_bound(timeline.begin(), timeline.end(), asOfDate,
+                                             [](const DATE& forDate, const t_interval& interval) { return forDate < interval.fromDate; });
+        if(intervalIter == timeline.begin())
+          return nullptr;
+        --intervalIter;
+        return intervalIter->contains(asOfDate) ? &(intervalIter->other) : nullptr;
+      }
+
+      inline std::span<const t_interval> timeline(const KEY& key) const
+      {
+        auto timelineIter = _timelines.find(key);
+        if(timelineIter == _timelines.end())
+          return {};
+        return std::span<const t_interval>(timelineIter->second);
+      }
+
+      // true if 'key' maps to anything but 'other' for some date in [fromDate, untilDate)
+      bool conflicts(const KEY& key, const OTHER& other, const DATE& fromDate, const std::optional<DATE>& untilDate) const
+      {
+        auto timelineIter = _timelines.find(key);
+        if(timelineIter == _timelines.end())
+          return false;
+
+        for(const t_interval& interval : timelineIter->second)
+        {
+          if(_overlaps(interval, fromDate, untilDate) && !_isSameOther(interval.other, other))
+            return true;
+        }
+        return false;
+      }
+
+      // caller has checked conflicts() : merges [fromDate, untilDate) with overlapping or adjacent intervals of 'other'
+      void insert(const KEY& key, const OTHER& other, const DATE& fromDate, const std::optional<DATE>& untilDate)
+      {
+        t_timeline& timeline = _timelines[key];
+        t_interval merged{fromDate, untilDate, other};
+        std::erase_if(timeline, [this, &merged](const t_interval& interval)
+                      {
+                        if(!_isSameOther(interval.other, merged.other) ||
+                           !(_overlaps(interval, merged.fromDate, merged.untilDate) || _adjacent(interval, merged)))
+                          return false;
+                        if(interval.fromDate < merged.fromDate)
+                          merged.fromDate = interval.fromDate;
+                        if(merged.untilDate.has_value() &&
+                           (!interval.untilDate.has_value() || merged.untilDate.value() < interval.untilDate.value()))
+                          merged.untilDate = interval.untilDate;
+                        return true;
+                      });
+        auto insertAt = std::upper_bound(timeline.begin(), timeline.end(), merged.fromDate,
+                                         [](const DATE& forDate, const t_interval& interval) { return forDate < interval.fromDate; });
+        timeline.insert(insertAt, std::move(merged));
+      }
+
+      inline size_t keyCount() const { return _timelines.size(); }
+
+      size_t intervalCount() const
+      {
+        size_t count = 0;
+        for(const auto& [key, timeline] : _timelines)
+          count += timeline.size();
+        return count;
+      }
+
+    private:
+      std::map<KEY, t_timeline, KCMP>  _timelines;
+      const OCMP                       _otherLessCompare;
+
+      inline bool _isSameOther(const OTHER& lhs, const OTHER& rhs) const
+      {
+        return !_otherLessCompare(lhs, rhs) && !_otherLessCompare(rhs, lhs);
+      }
+
+      static inline bool _overlaps(const t_interval& interval, const DATE& fromDate, const std::optional<DATE>& untilDate)
+      {
+        return (!untilDate.has_value()          || interval.fromDate < untilDate.value()) &&
+               (!interval.untilDate.has_value() || fromDate < interval.untilDate.value());
+      }
+
+      static inline bool _adjacent(const t_interval& lhs, const t_interval& rhs)
+      {
+        return (lhs.untilDate.has_value() && lhs.untilDate.value() == rhs.fromDate) ||
+               (rhs.untilDate.has_value() && rhs.untilDate.value() == lhs.fromDate);
+      }
+    };
+
+    _Timelines<LEFTT, RIGHT, LCMP, RCMP>  _lefttTimelines;
+    _Timelines<RIGHT, LEFTT, RCMP, LCMP>  _rightTimelines;
+
+  public:
+    TimeVersionedBiMap(const LCMP& lefttKeyLessCompare = LCMP{}, const RCMP& rightKeyLessCompare = RCMP{})
+      : _lefttTimelines(lefttKeyLessCompare, rightKeyLessCompare),
+        _rightTimelines(rightKeyLessCompare, lefttKeyLessCompare)
+    {}
+
+    /*
+     * maps lefttKey <-> rightKey over [fromDate, untilDate).
+     * Re-inserting an existing pair over an overlapping or adjacent range extends it.
+     * Throws if, on any date of the range, either key is already mapped to someone else.
+     */
+    void insert(const LEFTT& lefttKey, const RIGHT& rightKey,
+                const DATE& fromDate, const std::optional<DATE>& untilDate = std::nullopt)
+    {
+      if(untilDate.has_value() && !(fromDate < untilDate.value()))
+      {
+        throw std::invalid_argument("ERROR : TimeVersionedBiMap::insert() : untilDate is not after fromDate");
+      }
+      if(_lefttTimelines.conflicts(lefttKey, rightKey, fromDate, untilDate))
+      {
+        throw std::invalid_argument("ERROR : TimeVersionedBiMap::insert() : left-key is mapped to a different right-key in the date range");
+      }
+      if(_rightTimelines.conflicts(rightKey, lefttKey, fromDate, untilDate))
+      {
+        throw std::invalid_argument("ERROR : TimeVersionedBiMap::insert() : right-key is mapped to a different left-key in the date range");
+      }
+      _lefttTimelines.insert(lefttKey, rightKey, fromDate, untilDate);
+      _rightTimelines.insert(rightKey, lefttKey, fromDate, untilDate);
+    }
+
+    /*
+     * bulk load from built VersionedObject timelines, eg: a universe std::map<ISIN, VersionedObject>.
+     * 'toPair(objectKey, dataset)' returns the (LEFTT, RIGHT) pair a version maps to, or std::nullopt
+     * when the object has no mapping from that version on (eg: delisted).
+     * A version holds from its versionDate up to the next version's date; the last one is open ended.
+     */
+    template <typename UNIVERSE, typename TOPAIR>
+    void insertTimelines(const UNIVERSE& universe, TOPAIR&& toPair)
+    {
+      for(const auto& [objectKey, versionedObject] : universe)
+      {
+        const auto& datasetLedger = versionedObject.getDatasetLedger();
+        for(auto versionIter = datasetLedger.cbegin(); versionIter != datasetLedger.cend(); ++versionIter)
+        {
+          const std::optional<std::pair<LEFTT, RIGHT>> lefttRight = toPair(objectKey, versionIter->second);
+          if(!lefttRight.has_value())
+            continue;
+
+          auto nextIter = std::next(versionIter);
+          const std::optional<DATE> untilDate = (nextIter == datasetLedger.cend()) ? std::nullopt
+                                                                                   : std::optional<DATE>(nextIter->first);
+          insert(lefttRight->first, lefttRight->second, versionIter->first, untilDate);
+        }
+      }
+    }
+
+    // right-key mapped to 'lefttKey' on 'asOfDate', nullptr if none
+    inline const RIGHT* find_left(const LEFTT& lefttKey, const DATE& asOfDate) const
+    {
+      return _lefttTimelines.find(lefttKey, asOfDate);
+    }
+
+    // left-key mapped to 'rightKey' on 'asOfDate', nullptr if none
+    inline const LEFTT* find_right(const RIGHT& rightKey, const DATE& asOfDate) const
+    {
+      return _rightTimelines.find(rightKey, asOfDate);
+    }
+
+    // every interval of 'lefttKey', ascending fromDate
+    inline std::span<const t_lefttInterval> timeline_left(const LEFTT& lefttKey) const
+    {
+      return _lefttTimelines.timeline(lefttKey);
+    }
+
+    inline std::span<const t_rightInterval> timeline_right(const RIGHT& rightKey) const
+    {
+      return _rightTimelines.timeline(rightKey);
+    }
+
+    inline size_t size_left () const { return _lefttTimelines.keyCount(); }
+    inline size_t size_right() const { return _rightTimelines.keyCount(); }
+    inline size_t size_intervals() const { return _lefttTimelines.intervalCount(); }
+  };
+
+} }   //  namespace datastructure::bimap
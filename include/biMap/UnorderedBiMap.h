@@ -0,0 +1,349 @@
+/*
+ * UnorderedBiMap.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+
+#include <span>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <unordered_set>
+#include <unordered_map>
+
+#include <biMap/BiMap.h>
+
+
+namespace datastructure { namespace bimap
+{
+  /*
+   * batched find over a hash-table : one hash and one lookup per probe.
+   * Results are in probe order, map.end() for a missing key.
+   */
+  template <typename UMAP, typename KEY>
+  std::vector<typename UMAP::const_iterator> _findMany(const UMAP& umap, std::span<const KEY> probes)
+  {
+    std::vector<typename UMAP::const_iterator> found;
+    found.reserve(probes.size());
+    for(const KEY& probe : probes)
+    {
+      found.push_back(umap.find(probe));
+    }
+    return found;
+  }
+
+  /*
+   * Hash-table counterparts of BiMap_LR11_RL11 and BiMap_LR1M_RL11, with the same
+   * insert_left / find_left / find_right / size_* contract.
+   * Lookups are O(1) on average instead of O(log n); iteration order is unspecified.
+   * Returned iterators stay valid until the next insert that triggers a rehash,
+   * call reserve() upfront when the number of keys is known.
+   */
+  template < typename LEFTT, typename RIGHT,
+             typename LHASH = std::hash<LEFTT>, typename RHASH = std::hash<RIGHT>,
+             typename LKEYEQ = std::equal_to<LEFTT>, typename RKEYEQ = std::equal_to<RIGHT> >
+  class UnorderedBiMap_LR11_RL11
+  {
+  private:
+    std::unordered_map<LEFTT, RIGHT, LHASH, LKEYEQ>  _lefttMap;
+    std::unordered_map<RIGHT, LEFTT, RHASH, RKEYEQ>  _rightMap;
+
+    const decltype(_lefttMap)& _cLefttMap;
+    const decltype(_rightMap)& _cRightMap;
+
+  public:
+    using lefttMapIterator = typename std::unordered_map<LEFTT, RIGHT, LHASH, LKEYEQ>::iterator;
+    using rightMapIterator = typename std::unordered_map<RIGHT, LEFTT, RHASH, RKEYEQ>::iterator;
+
+    using const_lefttMapIterator = typename std::unordered_map<LEFTT, RIGHT, LHASH, LKEYEQ>::const_iterator;
+    using const_rightMapIterator = typename std::unordered_map<RIGHT, LEFTT, RHASH, RKEYEQ>::const_iterator;
+
+    UnorderedBiMap_LR11_RL11(const LHASH& lefttHash = LHASH{}, const RHASH& rightHash = RHASH{})
+      : _lefttMap(0, lefttHash),
+        _rightMap(0, rightHash),
+        _cLefttMap(_lefttMap),
+        _cRightMap(_rightMap)
+    {}
+
+    // references must bind to this object's maps, not to the source's
+    UnorderedBiMap_LR11_RL11(UnorderedBiMap_LR11_RL11 const& other)
+      : _lefttMap(other._lefttMap),
+        _rightMap(other._rightMap),
+        _cLefttMap(_lefttMap),
+        _cRightMap(_rightMap)
+    {}
+    UnorderedBiMap_LR11_RL11& operator=(UnorderedBiMap_LR11_RL11 const&) = delete;
+
+    ~UnorderedBiMap_LR11_RL11()
+    {
+      _lefttMap.clear();
+      _rightMap.clear();
+    }
+
+    inline std::pair<const_lefttMapIterator, bool> insert_left(const LEFTT& lefttKey, const RIGHT& rightKey)
+    {
+      const_lefttMapIterator lefttMapSearch = _cLefttMap.find(lefttKey);
+      if(lefttMapSearch != _cLefttMap.cend())
+      {
+        // lefttKey present in _lefttMap
+        return { lefttMapSearch, false };
+      }
+
+      const std::pair<rightMapIterator, bool> insertRightMap = _rightMap.emplace(rightKey, lefttKey);
+      if(!insertRightMap.second)
+      {
+        // rightKey present in _rightMap, mapped to a different lefttKey
+        const LEFTT& existingLefttKey = insertRightMap.first->second;
+        return { _cLefttMap.find(existingLefttKey), false };
+      }
+
+      const std::pair<lefttMapIterator, bool> insertLefttMap = _lefttMap.emplace(lefttKey, rightKey);
+      return { const_lefttMapIterator(insertLefttMap.first), true };
+    }
+
+    inline const_lefttMapIterator find_left(const LEFTT& lefttKey) const
+    {
+      return _cLefttMap.find(lefttKey);
+    }
+
+    inline const_rightMapIterator find_right(const RIGHT& rightKey) const
+    {
+      return _cRightMap.find(rightKey);
+    }
+
+    // heterogeneous lookups, eg: a std::string_view probe when the hasher and key-equal are transparent
+    template <typename LKEY>
+      requires c_transparent<LHASH> && c_transparent<LKEYEQ>
+    inline const_lefttMapIterator find_left(const LKEY& lefttKey) const
+    {
+      return _cLefttMap.find(lefttKey);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RHASH> && c_transparent<RKEYEQ>
+    inline const_rightMapIterator find_right(const RKEY& rightKey) const
+    {
+      return _cRightMap.find(rightKey);
+    }
+
+    // one result per probe, in probe order
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LEFTT> lefttKeys) const
+    {
+      return _findMany(_cLefttMap, lefttKeys);
+    }
+
+    template <typename LKEY>
+      requires c_transparent<LHASH> && c_transparent<LKEYEQ>
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LKEY> lefttKeys) const
+    {
+      return _findMany(_cLefttMap, lefttKeys);
+    }
+
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RIGHT> rightKeys) const
+    {
+      return _findMany(_cRightMap, rightKeys);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RHASH> && c_transparent<RKEYEQ>
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RKEY> rightKeys) const
+    {
+      return _findMany(_cRightMap, rightKeys);
+    }
+
+    inline bool isLeft_end(const_lefttMapIterator& checkEndIter) const
+    {
+      return checkEndIter == _cLefttMap.end();
+    }
+
+    inline bool isRight_end(const_rightMapIterator& checkEndIter) const
+    {
+      return checkEndIter == _cRightMap.end();
+    }
+
+    inline void reserve(size_t count)
+    {
+      _lefttMap.reserve(count);
+      _rightMap.reserve(count);
+    }
+
+    inline size_t size_left () const { return _lefttMap.size(); }
+    inline size_t size_right() const { return _rightMap.size(); }
+  };
+
+
+
+
+  template < typename LEFTT, typename RIGHT,
+             typename LHASH = std::hash<LEFTT>, typename RHASH = std::hash<RIGHT>,
+             typename LKEYEQ = std::equal_to<LEFTT>, typename RKEYEQ = std::equal_to<RIGHT> >
+  class UnorderedBiMap_LR1M_RL11
+  {
+  public:
+    using t_rightSet = std::unordered_set<RIGHT, RHASH, RKEYEQ>;
+
+  private:
+    std::unordered_map<LEFTT, t_rightSet, LHASH, LKEYEQ>  _lefttMap1ToM;
+    std::unordered_map<RIGHT, LEFTT, RHASH, RKEYEQ>       _rightMap1To1;
+
+    const decltype(_lefttMap1ToM)& _cLefttMap1ToM;
+    const decltype(_rightMap1To1)& _cRightMap1To1;
+
+    const RHASH   _rightHash;
+
+  public:
+    using lefttMapIterator = typename std::unordered_map<LEFTT, t_rightSet, LHASH, LKEYEQ>::iterator;
+    using rightMapIterator = typename std::unordered_map<RIGHT, LEFTT, RHASH, RKEYEQ>::iterator;
+    using rightSetIterator = typename t_rightSet::iterator;
+
+    using const_lefttMapIterator = typename std::unordered_map<LEFTT, t_rightSet, LHASH, LKEYEQ>::const_iterator;
+    using const_rightMapIterator = typename std::unordered_map<RIGHT, LEFTT, RHASH, RKEYEQ>::const_iterator;
+    using const_rightSetIterator = typename t_rightSet::const_iterator;
+
+
+    UnorderedBiMap_LR1M_RL11(const LHASH& lefttHash = LHASH{}, const RHASH& rightHash = RHASH{})
+      : _lefttMap1ToM(0, lefttHash),
+        _rightMap1To1(0, rightHash),
+        _cLefttMap1ToM(_lefttMap1ToM),
+        _cRightMap1To1(_rightMap1To1),
+        _rightHash(rightHash)
+    {}
+
+    // references must bind to this object's maps, not to the source's
+    UnorderedBiMap_LR1M_RL11(UnorderedBiMap_LR1M_RL11 const& other)
+      : _lefttMap1ToM(other._lefttMap1ToM),
+        _rightMap1To1(other._rightMap1To1),
+        _cLefttMap1ToM(_lefttMap1ToM),
+        _cRightMap1To1(_rightMap1To1),
+        _rightHash(other._rightHash)
+    {}
+    UnorderedBiMap_LR1M_RL11& operator=(UnorderedBiMap_LR1M_RL11 const&) = delete;
+
+    ~UnorderedBiMap_LR1M_RL11()
+    {
+      for(auto& manySet : _lefttMap1ToM)
+      {
+        manySet.second.clear();
+      }
+      _lefttMap1ToM.clear();
+      _rightMap1To1.clear();
+    }
+
+    inline std::pair<const_lefttMapIterator, bool> insert_left(const LEFTT& lefttKey, const RIGHT& rightKey)
+    {
+      const std::pair<rightMapIterator, bool> insertRightMap = _rightMap1To1.emplace(rightKey, lefttKey);
+      if(!insertRightMap.second)
+      {
+        //  rightKey exists, mapped either to lefttKey or to a different LEFT :
+        //  query LEFT-Iterator using the existing left-key and return false.
+        const LEFTT& existingLefttKey = insertRightMap.first->second;
+        return { _cLefttMap1ToM.find(existingLefttKey), false };
+      }
+      // In rightMap : rightKey didn't exist
+
+      // if existing left-node use that ELSE create a new left-node.
+      lefttMapIterator lefttMapSearch = _lefttMap1ToM.try_emplace(lefttKey, 0, _rightHash).first;
+      lefttMapSearch->second.emplace(rightKey);
+      return { const_lefttMapIterator(lefttMapSearch), true };
+    }
+
+    inline const_lefttMapIterator find_left(const LEFTT& lefttKey) const
+    {
+      return _cLefttMap1ToM.find(lefttKey);
+    }
+
+    inline const_rightMapIterator find_right(const RIGHT& rightKey) const
+    {
+      return _cRightMap1To1.find(rightKey);
+    }
+
+    // heterogeneous lookups, eg: a std::string_view probe when the hasher and key-equal are transparent
+    template <typename LKEY>
+      requires c_transparent<LHASH> && c_transparent<LKEYEQ>
+    inline const_lefttMapIterator find_left(const LKEY& lefttKey) const
+    {
+      return _cLefttMap1ToM.find(lefttKey);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RHASH> && c_transparent<RKEYEQ>
+    inline const_rightMapIterator find_right(const RKEY& rightKey) const
+    {
+      return _cRightMap1To1.find(rightKey);
+    }
+
+    // one result per probe, in probe order
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LEFTT> lefttKeys) const
+    {
+      return _findMany(_cLefttMap1ToM, lefttKeys);
+    }
+
+    template <typename LKEY>
+      requires c_transparent<LHASH> && c_transparent<LKEYEQ>
+    inline std::vector<const_lefttMapIterator> find_left_many(std::span<const LKEY> lefttKeys) const
+    {
+      return _findMany(_cLefttMap1ToM, lefttKeys);
+    }
+
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RIGHT> rightKeys) const
+    {
+      return _findMany(_cRightMap1To1, rightKeys);
+    }
+
+    template <typename RKEY>
+      requires c_transparent<RHASH> && c_transparent<RKEYEQ>
+    inline std::vector<const_rightMapIterator> find_right_many(std::span<const RKEY> rightKeys) const
+    {
+      return _findMany(_cRightMap1To1, rightKeys);
+    }
+
+    inline bool isLeft_end(const_lefttMapIterator& checkEndIter) const
+    {
+      return checkEndIter == _cLefttMap1ToM.end();
+    }
+
+    inline bool isRight_end(const_rightMapIterator& checkEndIter) const
+    {
+      return checkEndIter == _cRightMap1To1.end();
+    }
+
+    inline bool contains_left(const LEFTT& lefttKey, const RIGHT& rightKey) const
+    {
+      const_lefttMapIterator primIter = _cLefttMap1ToM.find(lefttKey);
+      if(primIter == _cLefttMap1ToM.end())
+        return false;
+
+      return primIter->second.find(rightKey) != primIter->second.end();
+    }
+
+    inline bool contains_right(const RIGHT& rightKey, const LEFTT& lefttKey) const
+    {
+      const_rightMapIterator secoIter = _cRightMap1To1.find(rightKey);
+      if(secoIter == _cRightMap1To1.end())
+        return false;
+
+      return LKEYEQ{}(secoIter->second, lefttKey);
+    }
+
+    // 'lefttCount' distinct left-keys and 'rightCount' right-keys expected
+    inline void reserve(size_t lefttCount, size_t rightCount)
+    {
+      _lefttMap1ToM.reserve(lefttCount);
+      _rightMap1To1.reserve(rightCount);
+    }
+
+    inline size_t size_left () const { return _lefttMap1ToM.size(); }
+    inline size_t size_right() const { return _rightMap1To1.size(); }
+  };
+
+} }   //  namespace datastructure::bimap
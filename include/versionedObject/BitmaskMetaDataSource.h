@@ -0,0 +1,242 @@
+/*
+ * BitmaskMetaDataSource.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <bit>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <shared_mutex>
+
+#include <versionedObject/VersionedObject.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  using DataTypeRegistryFull_exception = VO_exception<15>;
+
+  /*
+   * process wide interning of the merged-data-type keys of a metaData ( the key is the patch
+   * symbol followed by the dataType, e.g. "%symbolChange", "@nameSpot", "*crown" ) to small ids.
+   * Ids are handed out in order of first use and never released; at most MAX_DATATYPES keys.
+   */
+  class DataTypeRegistry
+  {
+  public:
+    using t_dataTypeId = uint8_t;
+    static constexpr size_t MAX_DATATYPES = 64;
+
+    static DataTypeRegistry& instance()
+    {
+      static DataTypeRegistry registry;
+      return registry;
+    }
+
+    DataTypeRegistry(DataTypeRegistry const&) = delete;
+    DataTypeRegistry& operator=(DataTypeRegistry const&) = delete;
+
+    // id of 'dataTypeKey', registered on first call
+    t_dataTypeId getId(const t_DataType& dataTypeKey)
+    {
+      {
+        std::shared_lock<std::shared_mutex> readLock(_registryMutex);
+        auto iter = _idByKey.find(dataTypeKey);
+        if(iter != _idByKey.end())
+          return iter->second;
+      }
+      std::unique_lock<std::shared_mutex> writeLock(_registryMutex);
+      auto iter = _idByKey.find(dataTypeKey);    // registered by another thread meanwhile
+      if(iter != _idByKey.end())
+        return iter->second;
+      if(_keyById.size() == MAX_DATATYPES)
+      {
+        std::ostringstream eoss;
+        eoss << "ERROR : DataTypeRegistry::getId() : cannot register dataType-key '" << dataTypeKey
+             << "', all " << MAX_DATATYPES << " ids are in use";
+        throw DataTypeRegistryFull_exception(eoss.str());
+      }
+      const t_dataTypeId newId = static_cast<t_dataTypeId>(_keyById.size());
+      _keyById.push_back(dataTypeKey);
+      _idByKey.emplace(dataTypeKey, newId);
+      return newId;
+    }
+
+    t_DataType getKey(t_dataTypeId dataTypeId) const
+    {
+      std::shared_lock<std::shared_mutex> readLock(_registryMutex);
+      return _keyById.at(dataTypeId);
+    }
+
+    size_t size() const
+    {
+      std::shared_lock<std::shared_mutex> readLock(_registryMutex);
+      return _keyById.size();
+    }
+
+    // calls fn(dataTypeKey) for the ids in 'idMask', in the order of their keys ( as a std::set<t_DataType> would )
+    template<typename FN>
+    void forEachKey(uint64_t idMask, FN&& fn) const
+    {
+      std::shared_lock<std::shared_mutex> readLock(_registryMutex);
+      for(auto iter = _idByKey.cbegin(); idMask != 0 && iter != _idByKey.cend(); ++iter)
+      {
+        const uint64_t idBit = uint64_t(1) << iter->second;
+        if(idMask & idBit)
+        {
+          fn(iter->first);
+          idMask &= ~idBit;
+        }
+      }
+    }
+
+  private:
+    DataTypeRegistry() : _registryMutex(), _idByKey(), _keyById() {}
+
+    mutable std::shared_mutex             _registryMutex;
+    std::map<t_DataType, t_dataTypeId>    _idByKey;     // in key order
+    std::vector<t_DataType>               _keyById;
+  };
+
+  // set of DataTypeRegistry ids, CONTAINER of BitmaskMetaDataSource
+  class DataTypeMask
+  {
+  public:
+    using t_dataTypeId = DataTypeRegistry::t_dataTypeId;
+
+    constexpr DataTypeMask() = default;
+    constexpr explicit DataTypeMask(uint64_t idMask) : _idMask(idMask) {}
+    explicit DataTypeMask(const std::set<t_DataType>& dataTypeKeys)
+    {
+      for(const t_DataType& dataTypeKey : dataTypeKeys)
+        insert(DataTypeRegistry::instance().getId(dataTypeKey));
+    }
+
+    constexpr bool operator==(DataTypeMask const& other) const = default;
+
+    constexpr size_t size()  const { return size_t(std::popcount(_idMask)); }
+    constexpr bool   empty() const { return _idMask == 0; }
+    constexpr void   clear()       { _idMask = 0; }
+    constexpr uint64_t getIdMask() const { return _idMask; }
+
+    constexpr bool contains(t_dataTypeId dataTypeId) const { return (_idMask & _idBit(dataTypeId)) != 0; }
+    // false if already present
+    constexpr bool insert(t_dataTypeId dataTypeId)
+    {
+      const bool inserted = !contains(dataTypeId);
+      _idMask |= _idBit(dataTypeId);
+      return inserted;
+    }
+    constexpr void erase(t_dataTypeId dataTypeId) { _idMask &= ~_idBit(dataTypeId); }
+    constexpr void merge(const DataTypeMask& other) { _idMask |= other._idMask; }
+
+    std::set<t_DataType> toSet() const
+    {
+      std::set<t_DataType> dataTypeKeys;
+      DataTypeRegistry::instance().forEachKey(_idMask, [&dataTypeKeys](const t_DataType& dataTypeKey)
+                                                       { dataTypeKeys.insert(dataTypeKeys.cend(), dataTypeKey); });
+      return dataTypeKeys;
+    }
+
+  private:
+    static constexpr uint64_t _idBit(t_dataTypeId dataTypeId) { return uint64_t(1) << dataTypeId; }
+
+    uint64_t  _idMask = 0;
+  };
+
+  /*
+   * MetaDataSource with the merged data-types held as a DataTypeMask : merging is a few bit
+   * operations on the ids interned at construction, with no string built or allocated.
+   * toCSV() output is identical to MetaDataSource's.
+   */
+  class BitmaskMetaDataSource;
+  using t_BaseBitmaskMetaDataSource = crtpMetaDataSource<BitmaskMetaDataSource, DataTypeMask>;
+  class BitmaskMetaDataSource
+        : public t_BaseBitmaskMetaDataSource
+  {
+  friend t_BaseBitmaskMetaDataSource;
+
+  private:
+    DataTypeRegistry::t_dataTypeId  _dataTypeKeyId;   // id of _dataPatch + _dataType
+
+    static inline DataTypeRegistry::t_dataTypeId _registerKey(eModificationPatch dataPatch, const t_DataType& dataType)
+    {
+      t_DataType dataTypeKey{char(dataPatch)};
+      dataTypeKey += dataType;
+      return DataTypeRegistry::instance().getId(dataTypeKey);
+    }
+
+    template<typename SH = StreamerHelper>
+    inline void _toCSV( std::ostream& oss, const SH& streamerHelper) const
+    {
+      const SH& sh = streamerHelper;
+      oss << _prefixBuildType << sh.getDelimiterMetaData()
+          << _dataPatch       << _dataType;
+
+      DataTypeRegistry::instance().forEachKey(_mergedDataTypes.getIdMask(), [&oss, &sh](const t_DataType& dataTypeKey)
+                                              { oss << sh.getDelimiterMetaData() << dataTypeKey; });
+    }
+
+    // same as crtpMetaDataSource::_mergeContainer(), on the ids
+    inline void _mergeContainer(const BitmaskMetaDataSource& other)
+    {
+      if(other._mergedDataTypes.contains(other._dataTypeKeyId))
+      {
+        throw MergeError_MetaDataSource_exception{"BitmaskMetaDataSource::_mergeContainer() : insert failed"};
+      }
+      _mergedDataTypes.merge(other._mergedDataTypes);
+      _mergedDataTypes.insert(other._dataTypeKeyId);
+      _mergedDataTypes.erase(_dataTypeKeyId);
+    }
+
+  public:
+    BitmaskMetaDataSource(const t_DataType& dataType, eBuildDirection prefixBuildType, eModificationPatch dataPatch,
+                          const StreamerHelper streamerHelper = StreamerHelper{})
+      : t_BaseBitmaskMetaDataSource(dataType, prefixBuildType, dataPatch, streamerHelper),
+        _dataTypeKeyId(_registerKey(dataPatch, dataType))
+    {}
+
+    BitmaskMetaDataSource(const t_DataType& dataType, eBuildDirection prefixBuildType, eModificationPatch dataPatch,
+                          const DataTypeMask& mergedDataTypes,
+                          const StreamerHelper streamerHelper = StreamerHelper{})
+      : t_BaseBitmaskMetaDataSource(dataType, prefixBuildType, dataPatch, mergedDataTypes, streamerHelper),
+        _dataTypeKeyId(_registerKey(dataPatch, dataType))
+    {}
+
+    explicit BitmaskMetaDataSource(const MetaDataSource& metaDataSource)
+      : BitmaskMetaDataSource(metaDataSource.getDataType(), metaDataSource.getBuildDirection(),
+                              metaDataSource.getModificationPatch(), DataTypeMask{metaDataSource.getMergedDataTypes()},
+                              metaDataSource.getStreamerHelper())
+    {}
+
+    BitmaskMetaDataSource() = delete;
+    BitmaskMetaDataSource(BitmaskMetaDataSource const&) = default;
+    BitmaskMetaDataSource(BitmaskMetaDataSource &&) = default;
+    BitmaskMetaDataSource& operator=(BitmaskMetaDataSource const&) = default;
+    bool operator==(BitmaskMetaDataSource const& other) const = default;
+
+    MetaDataSource toMetaDataSource() const
+    {
+      return MetaDataSource{_dataType, _prefixBuildType, _dataPatch, _mergedDataTypes.toSet(), _streamerHelper};
+    }
+
+    using t_BaseBitmaskMetaDataSource::_checkMergeChanges;
+    using t_BaseBitmaskMetaDataSource::_checkMergeVersion;
+
+    ~BitmaskMetaDataSource() {}
+  };
+
+} }   //  namespace datastructure::versionedObject
@@ -49,6 +49,7 @@ namespace datastructure { namespace versionedObject
     inline const std::array<eModificationPatch, sizeof...(T)>& getModifiedIndexes() const { return _modifiedElements; }
     inline eBuildDirection getBuildDirection() const { return _buildDirection; }
     inline const t_record& getNewRecord() const { return _newValues; }
+    inline const t_record& getOldRecord() const { return _oldValues; }
 
 
     bool isNextChgValueEqual(const t_record& matchRecord) const
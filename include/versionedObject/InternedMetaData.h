@@ -0,0 +1,204 @@
+/*
+ * InternedMetaData.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <utility>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+
+#include <versionedObject/VersionedObject.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  /*
+   * process wide pool of the distinct metaData values of type M, each stored once at a stable address.
+   * The results of mergeVersion() and mergeChanges() are memoized per pair of pooled values, so
+   * repeating a merge is a lookup.
+   */
+  template <c_MetaData M>
+  class MetaDataPool
+  {
+  public:
+    static MetaDataPool& instance()
+    {
+      static MetaDataPool pool;
+      return pool;
+    }
+
+    MetaDataPool(MetaDataPool const&) = delete;
+    MetaDataPool& operator=(MetaDataPool const&) = delete;
+
+    // the pooled value equal to 'metaData', added on first call
+    const M* intern(const M& metaData)
+    {
+      const std::string poolKey = metaData.toCSV(typename M::t_StreamerHelper{});
+      {
+        std::shared_lock<std::shared_mutex> readLock(_poolMutex);
+        const M* pooledMetaData = _find(poolKey, metaData);
+        if(pooledMetaData != nullptr)
+          return pooledMetaData;
+      }
+      std::unique_lock<std::shared_mutex> writeLock(_poolMutex);
+      const M* pooledMetaData = _find(poolKey, metaData);    // pooled by another thread meanwhile
+      if(pooledMetaData != nullptr)
+        return pooledMetaData;
+      _pooled[poolKey].push_back(std::make_unique<const M>(metaData));
+      ++_pooledCount;
+      return _pooled[poolKey].back().get();
+    }
+
+    inline const M* mergeVersion(const M* highPriority, const M* lowrPriority)
+    {
+      return _merged<true>(_mergedVersions, highPriority, lowrPriority);
+    }
+
+    inline const M* mergeChanges(const M* metaData, const M* otherNew)
+    {
+      return _merged<false>(_mergedChanges, metaData, otherNew);
+    }
+
+    size_t size() const
+    {
+      std::shared_lock<std::shared_mutex> readLock(_poolMutex);
+      return _pooledCount;
+    }
+
+  private:
+    using t_mergeMemo = std::map<std::pair<const M*, const M*>, const M*>;
+
+    MetaDataPool() : _poolMutex(), _pooled(), _pooledCount(0), _mergedVersions(), _mergedChanges() {}
+
+    // values with the same toCSV() differ at most in their StreamerHelper
+    const M* _find(const std::string& poolKey, const M& metaData) const
+    {
+      auto bucketIter = _pooled.find(poolKey);
+      if(bucketIter != _pooled.end())
+      {
+        for(const std::unique_ptr<const M>& pooledMetaData : bucketIter->second)
+        {
+          if(*pooledMetaData == metaData)
+            return pooledMetaData.get();
+        }
+      }
+      return nullptr;
+    }
+
+    // a merge that throws is not memoized
+    template<bool MERGE_VERSION>
+    const M* _merged(t_mergeMemo& mergeMemo, const M* lhs, const M* rhs)
+    {
+      {
+        std::shared_lock<std::shared_mutex> readLock(_poolMutex);
+        auto memoIter = mergeMemo.find({lhs, rhs});
+        if(memoIter != mergeMemo.end())
+          return memoIter->second;
+      }
+      M mergedMetaData{*lhs};
+      if constexpr(MERGE_VERSION) {
+        mergedMetaData.mergeVersion(*rhs);
+      } else {
+        mergedMetaData.mergeChanges(*rhs);
+      }
+      const M* pooledMetaData = intern(mergedMetaData);
+      std::unique_lock<std::shared_mutex> writeLock(_poolMutex);
+      mergeMemo.emplace(std::make_pair(lhs, rhs), pooledMetaData);
+      return pooledMetaData;
+    }
+
+    mutable std::shared_mutex                                             _poolMutex;
+    std::unordered_map<std::string, std::vector<std::unique_ptr<const M>>> _pooled;   // by toCSV()
+    size_t                                                                _pooledCount;
+    t_mergeMemo                                                           _mergedVersions;
+    t_mergeMemo                                                           _mergedChanges;
+  };
+
+  /*
+   * flyweight handle usable as the metaData of DataSet<M, T...> : a pointer to the pooled value
+   * ( see MetaDataPool ) instead of a full M per DataSet. Handles of equal values compare by identity,
+   * and mergeVersion()/mergeChanges() re-point the handle to the memoized result.
+   */
+  template <c_MetaData M = MetaDataSource>
+  class InternedMetaData
+  {
+  public:
+    using isMetaData = std::true_type;
+    using t_metaData = M;
+    using t_Container = typename M::t_Container;
+    using t_StreamerHelper = typename M::t_StreamerHelper;
+
+    explicit InternedMetaData(const M& metaData)
+      : _pooledMetaData(MetaDataPool<M>::instance().intern(metaData))
+    {}
+
+    InternedMetaData() = delete;
+    InternedMetaData(InternedMetaData const&) = default;
+    InternedMetaData(InternedMetaData &&) = default;
+    InternedMetaData& operator=(InternedMetaData const&) = default;
+    bool operator==(InternedMetaData const& other) const { return _pooledMetaData == other._pooledMetaData; }
+
+    inline void mergeChanges(const InternedMetaData& otherNew)
+    {
+      _pooledMetaData = MetaDataPool<M>::instance().mergeChanges(_pooledMetaData, otherNew._pooledMetaData);
+    }
+
+    inline void mergeVersion(const InternedMetaData& otherLowPriority)
+    {
+      _pooledMetaData = MetaDataPool<M>::instance().mergeVersion(_pooledMetaData, otherLowPriority._pooledMetaData);
+    }
+
+    inline const M& get() const { return *_pooledMetaData; }
+
+    eBuildDirection getBuildDirection() const { return _pooledMetaData->getBuildDirection(); }
+    eModificationPatch getModificationPatch() const { return _pooledMetaData->getModificationPatch(); }
+    t_DataType getDataType() const { return _pooledMetaData->getDataType(); }
+    const t_Container& getMergedDataTypes() const { return _pooledMetaData->getMergedDataTypes(); }
+    const t_StreamerHelper& getStreamerHelper() const { return  _pooledMetaData->getStreamerHelper(); }
+
+    template<typename SH = t_StreamerHelper>
+    inline void toCSV(std::ostream& oss, const SH& streamerHelper) const
+    {
+      _pooledMetaData->toCSV(oss, streamerHelper);
+    }
+
+    inline void toCSV(std::ostream& oss) const
+    {
+      _pooledMetaData->toCSV(oss);
+    }
+
+    template<typename SH = t_StreamerHelper>
+    inline std::string toCSV(
+      typename std::enable_if_t<  !std::is_same_v<SH, std::ostream&>,
+                                  const SH& >
+      streamerHelper) const
+    {
+      return _pooledMetaData->template toCSV<SH>(streamerHelper);
+    }
+
+    inline std::string toCSV() const
+    {
+      return _pooledMetaData->toCSV();
+    }
+
+  private:
+    const M*  _pooledMetaData;
+  };
+
+} }   //  namespace datastructure::versionedObject
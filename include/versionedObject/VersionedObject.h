@@ -20,7 +20,12 @@
 #include <string>
 #include <sstream>
 #include <chrono>
+#include <atomic>
+#include <vector>
+#include <cstdint>
 #include <utility>
+#include <memory>
+#include <algorithm>
 
 #include <optional>
 #include <iterator>
@@ -103,6 +108,7 @@ namespace datastructure { namespace versionedObject
   using EnumMismatch_MetaDataSource_exception   =  VO_exception<8>;
   using InvalidEnum_MetaDataSource_exception    =  VO_exception<9>;
   using MergeError_MetaDataSource_exception     =  VO_exception<10>;
+  using ChangeTracking_Disabled_exception       =  VO_exception<17>;
 
 
   inline eModificationPatch char2ModificationPatch(const char cModificationPatch)
@@ -220,6 +226,16 @@ namespace datastructure { namespace versionedObject
       }
     }
 
+    // used when re-materializing a previously merged meta-data (e.g. journal replay)
+    crtpMetaDataSource(const t_DataType& dataType,
+                       eBuildDirection prefixBuildType, eModificationPatch dataPatch,
+                       const CONTAINER& mergedDataTypes,
+                       const SHD streamerHelper = SHD{} )
+      : crtpMetaDataSource(dataType, prefixBuildType, dataPatch, streamerHelper)
+    {
+      _mergedDataTypes = mergedDataTypes;
+    }
+
     crtpMetaDataSource() = delete;
     crtpMetaDataSource(crtpMetaDataSource const&) = default;
     crtpMetaDataSource(crtpMetaDataSource &&) = default;
@@ -246,6 +262,7 @@ namespace datastructure { namespace versionedObject
     eBuildDirection getBuildDirection() const { return _prefixBuildType; }
     eModificationPatch getModificationPatch() const { return _dataPatch; }
     t_DataType getDataType() const { return _dataType; }
+    const CONTAINER& getMergedDataTypes() const { return _mergedDataTypes; }
     const SHD& getStreamerHelper() const { return  _streamerHelper; }
 
     virtual ~crtpMetaDataSource() { _mergedDataTypes.clear(); }
@@ -441,6 +458,12 @@ namespace datastructure { namespace versionedObject
       : crtpMetaDataSource<MetaDataSource , std::set<t_DataType> >(dataType, prefixBuildType, dataPatch, streamerHelper)
     {}
 
+    MetaDataSource(const t_DataType& dataType, eBuildDirection prefixBuildType, eModificationPatch dataPatch,
+                   const std::set<t_DataType>& mergedDataTypes,
+                   const StreamerHelper streamerHelper = StreamerHelper{})
+      : crtpMetaDataSource<MetaDataSource , std::set<t_DataType> >(dataType, prefixBuildType, dataPatch, mergedDataTypes, streamerHelper)
+    {}
+
     MetaDataSource() = delete;
     MetaDataSource(MetaDataSource const&) = default;
     MetaDataSource(MetaDataSource &&) = default;
@@ -483,6 +506,11 @@ namespace datastructure { namespace versionedObject
         _record(record)
     {}
 
+    DataSet(M&& metaData, const t_record& record)
+      : _metaData(std::move(metaData)),
+        _record(record)
+    {}
+
     DataSet(DataSet<M, T...> const& other)
       : _metaData(other._metaData),
         _record(other._record)
@@ -614,6 +642,20 @@ namespace datastructure { namespace versionedObject
   };
 
 
+  /*
+   * what VersionedObject::compact() does with a version whose record is the same as that of
+   * the version just before it :
+   *   NONE : nothing, the version is kept
+   *   DROP : the version is removed
+   *   FOLD : the version is removed, its metaData merged ( mergeVersion() ) into the version kept;
+   *          a version whose metaData cannot be merged is kept
+   */
+  enum class eCompactPolicy : char {
+    NONE,
+    DROP,
+    FOLD
+  };
+
   template <typename VDT, typename ... MT>
   class VersionedObject
   {
@@ -623,17 +665,33 @@ namespace datastructure { namespace versionedObject
     using t_datasetLedger  = std::map< t_versionDate, t_dataset >;
     using t_record         = typename t_dataset::t_record;
     using t_StreamerHelper = typename t_dataset::t_StreamerHelper;
+    using t_generation     = uint64_t;
 
-    VersionedObject() : _datasetLedger() {}
+    VersionedObject() : _datasetLedger(), _insertionLog() {}
     virtual ~VersionedObject()
     {
       _datasetLedger.clear();
     }
 
     //VersionedObject() = delete;
-    VersionedObject(VersionedObject<VDT, MT...> const&) = default;
-    VersionedObject& operator=(VersionedObject<VDT, MT...> const&) = default;
-    bool operator==(VersionedObject<VDT, MT...> const&) const = default;
+    VersionedObject(VersionedObject<VDT, MT...> const& other)
+      : _datasetLedger(other._datasetLedger),
+        _insertionLog(other._insertionLog ? std::make_unique<t_insertionLog>(*other._insertionLog) : nullptr)
+    {}
+    VersionedObject& operator=(VersionedObject<VDT, MT...> const& other)
+    {
+      if(this != &other)
+      {
+        _datasetLedger = other._datasetLedger;
+        _insertionLog  = other._insertionLog ? std::make_unique<t_insertionLog>(*other._insertionLog) : nullptr;
+      }
+      return *this;
+    }
+    // equality is on the versions only, not on when they were inserted
+    bool operator==(VersionedObject<VDT, MT...> const& other) const
+    {
+      return _datasetLedger == other._datasetLedger;
+    }
 
     // throws an error if for a particular date existing-record doesn't match the new-record
     // returns false if same record exists
@@ -652,9 +710,172 @@ namespace datastructure { namespace versionedObject
 #endif
         throw VO_Record_Mismatch_exception(errMsg);
       }
+      if(success)
+      {
+        _stampInsertion(forDate);
+      }
       return success;
     }
 
+    /*
+     * for versions produced in versionDate order ( e.g. a merge ) : when 'forDate' is after the
+     * last version, the dataset is constructed in place at the end of the ledger, without
+     * a lookup or a duplicate check. Otherwise same as insertVersion().
+     */
+    template<typename ... ARGS>
+    inline bool appendVersion(const t_versionDate& forDate, ARGS&& ... datasetArgs)
+    {
+      if(!_datasetLedger.empty() && !(_datasetLedger.crbegin()->first < forDate))
+      {
+        return insertVersion(forDate, t_dataset{std::forward<ARGS>(datasetArgs)...});
+      }
+      _datasetLedger.emplace_hint(_datasetLedger.cend(), std::piecewise_construct,
+                                  std::forward_as_tuple(forDate),
+                                  std::forward_as_tuple(std::forward<ARGS>(datasetArgs)...));
+      _stampInsertion(forDate);
+      return true;
+    }
+
+    // as above, re-using a node of another ledger ( see releaseLedger() )
+    inline bool appendVersion(typename t_datasetLedger::node_type&& versionNode)
+    {
+      if(!_datasetLedger.empty() && !(_datasetLedger.crbegin()->first < versionNode.key()))
+      {
+        return insertVersion(versionNode.key(), versionNode.mapped());
+      }
+      _stampInsertion(versionNode.key());
+      _datasetLedger.insert(_datasetLedger.cend(), std::move(versionNode));
+      return true;
+    }
+
+    // hands the versions over to the caller and leaves this object empty
+    inline t_datasetLedger releaseLedger()
+    {
+      if(_insertionLog)
+      {
+        _insertionLog->clear();
+      }
+      return std::exchange(_datasetLedger, t_datasetLedger{});
+    }
+
+    // removes all versions; change tracking, if enabled, stays enabled with an empty log
+    inline void clear()
+    {
+      _datasetLedger.clear();
+      if(_insertionLog)
+      {
+        _insertionLog->clear();
+      }
+    }
+
+    // capacity for 'versionCount' more versions; the ledger is node based, only the insertion-log is reserved
+    inline void reserveVersions(size_t versionCount)
+    {
+      if(_insertionLog)
+      {
+        _insertionLog->reserve(_insertionLog->size() + versionCount);
+      }
+    }
+
+    /*
+     * one pass over the ledger, removing each version whose record is the same as the version
+     * before it; getVersionAt() returns the same record for every date afterwards. A version whose
+     * metaData changed on a FOLD is re-stamped in the change-feed. Returns the number of versions removed.
+     * On a FOLD, a version whose metaData cannot be merged ( mergeVersion() throws, e.g. a SNAPSHOT
+     * after a DELTACHANGE ) is kept, and the versions after it fold into it instead.
+     * Every fold is computed before the ledger is touched : when compact() throws, 'this' is unchanged.
+     */
+    size_t compact(eCompactPolicy compactPolicy)
+    {
+      if(compactPolicy == eCompactPolicy::NONE || _datasetLedger.size() < 2)
+      {
+        return 0;
+      }
+
+      std::vector<typename t_datasetLedger::iterator> removedIters;
+      std::vector<t_versionDate> removedDates, foldedDates;   // both in versionDate order
+      std::vector<std::pair<typename t_datasetLedger::iterator, typename t_datasetLedger::node_type>> foldedNodes;
+      for(auto keptIter = _datasetLedger.begin(); keptIter != _datasetLedger.end(); )
+      {
+        auto runEnd = std::next(keptIter);
+        while(runEnd != _datasetLedger.end() && runEnd->second == keptIter->second)
+        {
+          ++runEnd;
+        }
+        if constexpr(t_dataset::hasMetaData())
+        {
+          if(compactPolicy == eCompactPolicy::FOLD)
+          {
+            _planFold(keptIter, runEnd, removedIters, foldedNodes);
+            keptIter = runEnd;
+            continue;
+          }
+        }
+        for(auto removedIter = std::next(keptIter); removedIter != runEnd; ++removedIter)
+        {
+          removedIters.push_back(removedIter);
+        }
+        keptIter = runEnd;
+      }
+      if(_insertionLog)
+      {
+        removedDates.reserve(removedIters.size());
+        for(const auto& removedIter : removedIters)
+        {
+          removedDates.push_back(removedIter->first);
+        }
+        foldedDates.reserve(foldedNodes.size());
+        for(const auto& foldedNode : foldedNodes)
+        {
+          foldedDates.push_back(foldedNode.first->first);
+        }
+        _insertionLog->reserve(_insertionLog->size() + foldedDates.size());
+      }
+
+      // nothing below allocates or throws
+      for(auto& [keptIter, foldedNode] : foldedNodes)
+      {
+        const auto hint = std::next(keptIter);
+        _datasetLedger.extract(keptIter);
+        _datasetLedger.insert(hint, std::move(foldedNode));
+      }
+      for(const auto& removedIter : removedIters)
+      {
+        _datasetLedger.erase(removedIter);
+      }
+      _restampInsertionLog(removedDates, foldedDates);
+      VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:  VersionedObject<VDT, MT...>::compact() : removed=" << removedIters.size() << ", folded=" << foldedNodes.size());
+      return removedIters.size();
+    }
+
+    /*
+     * retention : drops the versions before 'cutoffDate'. When no version is on 'cutoffDate', the
+     * version in effect on it is copied to 'cutoffDate' as the new baseline, so getVersionAt() is
+     * unchanged for every date from 'cutoffDate' on. Before anything is dropped, the versions to be
+     * dropped are handed to prunedHistory(first, last) e.g. to archive them.
+     * Returns the number of versions dropped.
+     * The baseline copies the metaData too : an export then shows e.g. the '+|%symbolChange' of the
+     * version in effect on 'cutoffDate'. Pass 'baselineMetaData' (e.g. a "baseline" IsRECORD/FullRECORD
+     * source) to stamp the baseline with it instead.
+     */
+    template<typename FN>
+    size_t pruneBefore(const t_versionDate& cutoffDate, FN&& prunedHistory)
+    {
+      return _pruneBefore(cutoffDate, prunedHistory, [](const t_dataset& inEffect) { return t_dataset{inEffect}; });
+    }
+
+    template<c_MetaData MD, typename FN>
+    size_t pruneBefore(const t_versionDate& cutoffDate, const MD& baselineMetaData, FN&& prunedHistory)
+    {
+      return _pruneBefore(cutoffDate, prunedHistory,
+                          [&baselineMetaData](const t_dataset& inEffect) { return t_dataset{baselineMetaData, inEffect.getRecord()}; });
+    }
+
+    inline size_t pruneBefore(const t_versionDate& cutoffDate)
+    {
+      return pruneBefore(cutoffDate, [](typename t_datasetLedger::const_iterator, typename t_datasetLedger::const_iterator) {});
+    }
+
     inline typename t_datasetLedger::const_iterator
     getVersionAt(const t_versionDate& forDate) const
     {
@@ -707,8 +928,191 @@ namespace datastructure { namespace versionedObject
       return _datasetLedger;
     }
 
+    /*
+     * change-feed ( opt-in, see enableChangeTracking() ) :
+     *   on a tracked object every successful insertVersion() is stamped with the next value of a
+     *   generation-clock that is shared by all VersionedObject's of the same type. A consumer remembers
+     *   getGeneration() at the time of a pull, and on the next pull asks only for
+     *   versions inserted after it. The same watermark can be used across a whole universe.
+     *   Untracked objects ( the default ) keep no insertion-log and never touch the clock.
+     */
+    static inline t_generation getGeneration()
+    {
+      return _generationClock.load();
+    }
+
+    // starts the insertion-log; versions already present are stamped as if inserted now
+    void enableChangeTracking()
+    {
+      if(_insertionLog)
+      {
+        return;
+      }
+      _insertionLog = std::make_unique<t_insertionLog>();
+      _insertionLog->reserve(_datasetLedger.size());
+      for(const auto& version : _datasetLedger)
+      {
+        _stampInsertion(version.first);
+      }
+    }
+
+    inline void disableChangeTracking()
+    {
+      _insertionLog.reset();
+    }
+
+    inline bool isChangeTracked() const
+    {
+      return static_cast<bool>(_insertionLog);
+    }
+
+    /*
+     * drops the insertion-log entries up to and including 'generation', once every consumer has
+     * pulled past it; getVersionsInsertedSince() is then only meaningful for a later generation.
+     * Returns the number of entries dropped.
+     */
+    size_t trimInsertionLogUpTo(t_generation generation)
+    {
+      if(!_insertionLog)
+      {
+        return 0;
+      }
+      const auto trimEnd = std::upper_bound(_insertionLog->cbegin(), _insertionLog->cend(), generation,
+                                            [](t_generation gen, const t_insertionEntry& entry) { return gen < entry.first; });
+      const size_t trimmedCount = static_cast<size_t>(std::distance(_insertionLog->cbegin(), trimEnd));
+      _insertionLog->erase(_insertionLog->cbegin(), trimEnd);
+      return trimmedCount;
+    }
+
+    // versions with versionDate >= 'watermark'
+    inline typename t_datasetLedger::const_iterator
+    getVersionsFrom(const t_versionDate& watermark) const
+    {
+      return _datasetLedger.lower_bound(watermark);
+    }
+
+    // versions inserted after generation 'sinceGeneration', in versionDate order
+    std::vector<typename t_datasetLedger::const_iterator>
+    getVersionsInsertedSince(t_generation sinceGeneration) const
+    {
+      if(!_insertionLog)
+      {
+        throw ChangeTracking_Disabled_exception("ERROR : VersionedObject<VDT, MT...>::getVersionsInsertedSince() : change tracking is not enabled");
+      }
+      auto logIter = std::upper_bound(_insertionLog->cbegin(), _insertionLog->cend(), sinceGeneration,
+                                      [](t_generation gen, const t_insertionEntry& entry) { return gen < entry.first; });
+      std::vector<typename t_datasetLedger::const_iterator> versions;
+      versions.reserve(static_cast<size_t>(std::distance(logIter, _insertionLog->cend())));
+      for(; logIter != _insertionLog->cend(); ++logIter)
+      {
+        versions.push_back(_datasetLedger.find(logIter->second));
+      }
+      std::sort(versions.begin(), versions.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs->first < rhs->first; });
+      return versions;
+    }
+
   private:
-    t_datasetLedger  _datasetLedger;
+    using t_insertionEntry = std::pair<t_generation, t_versionDate>;
+    using t_insertionLog   = std::vector<t_insertionEntry>;   // ascending generation
+
+    inline void _stampInsertion(const t_versionDate& forDate)
+    {
+      if(_insertionLog)
+      {
+        _insertionLog->emplace_back(++_generationClock, forDate);
+      }
+    }
+
+    // 'makeBaseline' builds the baseline dataset from the one in effect on 'cutoffDate'
+    template<typename FN, typename BASELINE_FN>
+    size_t _pruneBefore(const t_versionDate& cutoffDate, FN& prunedHistory, BASELINE_FN&& makeBaseline)
+    {
+      const auto pruneEnd = _datasetLedger.lower_bound(cutoffDate);
+      if(pruneEnd == _datasetLedger.begin())
+      {
+        return 0;
+      }
+      prunedHistory(_datasetLedger.cbegin(), typename t_datasetLedger::const_iterator{pruneEnd});
+
+      const size_t prunedCount = static_cast<size_t>(std::distance(_datasetLedger.begin(), pruneEnd));
+      const bool isBaselineNeeded = (pruneEnd == _datasetLedger.end() || cutoffDate < pruneEnd->first);
+      const auto keptBegin = isBaselineNeeded ? _datasetLedger.emplace_hint(pruneEnd, cutoffDate, makeBaseline(std::prev(pruneEnd)->second))
+                                              : pruneEnd;
+      _datasetLedger.erase(_datasetLedger.begin(), keptBegin);
+      if(_insertionLog)
+      {
+        std::erase_if(*_insertionLog, [&cutoffDate](const t_insertionEntry& entry) { return entry.second < cutoffDate; });
+      }
+      if(isBaselineNeeded)
+      {
+        _stampInsertion(cutoffDate);
+      }
+      VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:  VersionedObject<VDT, MT...>::pruneBefore() : cutoffDate=" << cutoffDate << ", pruned=" << prunedCount);
+      return prunedCount;
+    }
+
+    /*
+     * plans the FOLD of the run [keptIter, runEnd) of same-record versions, on copies of their metaData.
+     * A version whose metaData cannot be merged into the one kept before it is kept itself.
+     * The datasets whose metaData changed are built into 'foldedNodes', ready to replace the kept ones.
+     */
+    void _planFold(typename t_datasetLedger::iterator keptIter,
+                   typename t_datasetLedger::iterator runEnd,
+                   std::vector<typename t_datasetLedger::iterator>& removedIters,
+                   std::vector<std::pair<typename t_datasetLedger::iterator, typename t_datasetLedger::node_type>>& foldedNodes)
+    {
+      using t_metaData = typename t_dataset::t_metaData;
+      std::optional<t_metaData> foldedMetaData;
+      auto planKept = [&keptIter, &foldedMetaData, &foldedNodes]()
+      {
+        if(foldedMetaData.has_value() && !(*foldedMetaData == keptIter->second.getMetaData()))
+        {
+          t_datasetLedger foldedLedger;
+          foldedLedger.emplace(std::piecewise_construct,
+                               std::forward_as_tuple(keptIter->first),
+                               std::forward_as_tuple(std::move(*foldedMetaData), keptIter->second.getRecord()));
+          foldedNodes.emplace_back(keptIter, foldedLedger.extract(foldedLedger.begin()));
+        }
+        foldedMetaData.reset();
+      };
+      for(auto iter = std::next(keptIter); iter != runEnd; ++iter)
+      {
+        t_metaData mergedMetaData{foldedMetaData.has_value() ? *foldedMetaData : keptIter->second.getMetaData()};
+        try {
+          mergedMetaData.mergeVersion(iter->second.getMetaData());
+        } catch (const MergeError_MetaDataSource_exception&) {
+          planKept();
+          keptIter = iter;
+          continue;
+        }
+        foldedMetaData.emplace(std::move(mergedMetaData));
+        removedIters.push_back(iter);
+      }
+      planKept();
+    }
+
+    // drops the insertion-log entries of removed versions, and stamps the folded ones anew
+    void _restampInsertionLog(const std::vector<t_versionDate>& removedDates,
+                              const std::vector<t_versionDate>& foldedDates)
+    {
+      if(removedDates.empty() || !_insertionLog)
+      {
+        return;
+      }
+      std::erase_if(*_insertionLog, [&removedDates, &foldedDates](const t_insertionEntry& entry)
+                                    { return std::binary_search(removedDates.cbegin(), removedDates.cend(), entry.second) ||
+                                             std::binary_search(foldedDates.cbegin(), foldedDates.cend(), entry.second); });
+      for(const t_versionDate& foldedDate : foldedDates)
+      {
+        _stampInsertion(foldedDate);
+      }
+    }
+
+    inline static std::atomic<t_generation>  _generationClock{0};
+
+    t_datasetLedger                  _datasetLedger;
+    std::unique_ptr<t_insertionLog>  _insertionLog;   // null while change tracking is disabled
 
   };
 
@@ -61,10 +61,12 @@ namespace datastructure { namespace versionedObject
 
     t_deltaEntriesMap     _deltaChgEntries;
     t_snapShotEntriesMap  _snapShotEntries;
+    eCompactPolicy        _postBuildCompaction;
 
     _VersionedObjectBuilderBase() :
         _deltaChgEntries{},
-        _snapShotEntries{}
+        _snapShotEntries{},
+        _postBuildCompaction{eCompactPolicy::NONE}
     {}
 
     inline static t_dataset _datasetFactory(
@@ -1063,6 +1065,22 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
     inline const t_deltaEntriesMap& getDeltaChangeMap() const { return _deltaChgEntries; }
     inline const t_snapShotEntriesMap& getSnapShotMap() const { return _snapShotEntries; }
 
+    // replaces the entries of 'forDate' with the ones given ( all of 'forDate' ), e.g. to undo an insert...Version().
+    // The nodes are spliced in : nothing is allocated.
+    inline void resetVersionsAt(const VDT& forDate,
+                                t_deltaEntriesMap&& deltaEntries,
+                                t_snapShotEntriesMap&& snapShotEntries)
+    {
+      _deltaChgEntries.erase(forDate);
+      _snapShotEntries.erase(forDate);
+      _deltaChgEntries.merge(deltaEntries);
+      _snapShotEntries.merge(snapShotEntries);
+    }
+
+    // VersionedObject::compact() applied to the VersionedObject at the end of every build...Timeline()
+    inline void setPostBuildCompaction(eCompactPolicy compactPolicy) { _postBuildCompaction = compactPolicy; }
+    inline eCompactPolicy getPostBuildCompaction() const { return _postBuildCompaction; }
+
     virtual ~_VersionedObjectBuilderBase()
     {
       clear();
@@ -1103,6 +1121,7 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, M, T...>::buildForwardTimeline(START)");
       t_deltaEntriesMap comboChgEntries = this->getCombinedChangeDataSet();
       this->_buildForwardTimeline(vo, comboChgEntries);
+      vo.compact(this->_postBuildCompaction);
       comboChgEntries.clear();
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, M, T...>::buildForwardTimeline(END)");
     }
@@ -1114,6 +1133,7 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, M, T...>::buildReverseTimeline(START) : startDate=" << startDate);
       t_deltaEntriesMap comboChgEntries = this->getCombinedChangeDataSet();
       this->_buildReverseTimeline(startDate, vo, comboChgEntries);
+      vo.compact(this->_postBuildCompaction);
       comboChgEntries.clear();
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, M, T...>::buildReverseTimeline(END)");
     }
@@ -1128,6 +1148,7 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
       t_deltaEntriesMap comboChgEntries = this->getCombinedChangeDataSet();
       std::pair< t_deltaEntriesMap_iter_diff_type, t_deltaEntriesMap_iter_diff_type >
             ret = this->_buildBiDirectionalTimeline(startDates, vo, comboChgEntries);
+      vo.compact(this->_postBuildCompaction);
       comboChgEntries.clear();
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, M, T...>::buildBiDirectionalTimeline(END)");
       return ret;
@@ -1160,6 +1181,7 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, T1, TR...>::buildForwardTimeline(START)");
       t_deltaEntriesMap comboChgEntries = this->getCombinedChangeDataSet();
       this->_buildForwardTimeline(vo, comboChgEntries);
+      vo.compact(this->_postBuildCompaction);
       comboChgEntries.clear();
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, T1, TR...>::buildForwardTimeline(END)");
     }
@@ -1171,6 +1193,7 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, T1, TR...>::buildReverseTimeline(START) : startDate=" << startDate);
       t_deltaEntriesMap comboChgEntries = this->getCombinedChangeDataSet();
       this->_buildReverseTimeline(startDate, vo, comboChgEntries);
+      vo.compact(this->_postBuildCompaction);
       comboChgEntries.clear();
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, T1, TR...>::buildReverseTimeline(END)");
     }
@@ -1185,6 +1208,7 @@ VERSIONEDOBJECT_DEBUG_MSG("DEBUG_LOG:   iterISVOcopyBegin->first = " << _checkDa
       t_deltaEntriesMap comboChgEntries = this->getCombinedChangeDataSet();
       std::pair< t_deltaEntriesMap_iter_diff_type, t_deltaEntriesMap_iter_diff_type >
                 ret = this->_buildBiDirectionalTimeline(startDates, vo, comboChgEntries);
+      vo.compact(this->_postBuildCompaction);
       comboChgEntries.clear();
       VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:##VersionedObjectBuilder<VDT, T1, TR...>::buildBiDirectionalTimeline(END)");
       return ret;
@@ -0,0 +1,456 @@
+/*
+ * VersionedObjectCodec.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <set>
+#include <array>
+#include <tuple>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <concepts>
+#include <type_traits>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/InternedMetaData.h>
+#include <versionedObject/SnapshotDataSet.h>
+#include <versionedObject/ChangesInDataSet.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  using VO_Codec_exception = VO_exception<11>;
+
+  /*
+   * compact binary encoding of versionedObject types, used by the journal and the universe file.
+   * integers are written little-endian irrespective of host byte-order.
+   */
+  class BinaryWriter
+  {
+  public:
+    BinaryWriter(std::string& buffer) : _buffer(buffer) {}
+
+    template<std::unsigned_integral U>
+    inline void putUnsigned(U val)
+    {
+      for(size_t iii = 0; iii < sizeof(U); ++iii)
+      {
+        _buffer.push_back(static_cast<char>(static_cast<uint8_t>(val >> (8*iii))));
+      }
+    }
+
+    inline void putBytes(const char* data, size_t len) { _buffer.append(data, len); }
+
+    inline size_t size() const { return _buffer.size(); }
+
+  private:
+    std::string& _buffer;
+  };
+
+  class BinaryReader
+  {
+  public:
+    BinaryReader(const char* data, size_t len) : _cur(data), _end(data + len) {}
+
+    template<std::unsigned_integral U>
+    inline U getUnsigned()
+    {
+      _require(sizeof(U));
+      U val = 0;
+      for(size_t iii = 0; iii < sizeof(U); ++iii)
+      {
+        val = static_cast<U>(val | (static_cast<U>(static_cast<uint8_t>(_cur[iii])) << (8*iii)));
+      }
+      _cur += sizeof(U);
+      return val;
+    }
+
+    inline const char* getBytes(size_t len)
+    {
+      _require(len);
+      const char* start = _cur;
+      _cur += len;
+      return start;
+    }
+
+    inline size_t remaining() const { return static_cast<size_t>(_end - _cur); }
+
+  private:
+    const char* _cur;
+    const char* const _end;
+
+    inline void _require(size_t len) const
+    {
+      if(remaining() < len)
+      {
+        std::ostringstream eoss;
+        eoss << "ERROR : BinaryReader : attempt to read " << len << " bytes with only " << remaining() << " bytes remaining";
+        throw VO_Codec_exception(eoss.str());
+      }
+    }
+  };
+
+
+  /*
+   * customization point : specialize BinaryCodec<T> for user-defined column types or
+   * user-defined MetaData classes. Each specialization provides
+   *      static void encode(BinaryWriter&, const T&);
+   *      static T    decode(BinaryReader&);
+   */
+  template<typename T>
+  struct BinaryCodec;
+
+  template<typename T>
+  concept c_binaryCodable = requires(BinaryWriter& bw, BinaryReader& br, const T& val) {
+    BinaryCodec<T>::encode(bw, val);
+    { BinaryCodec<T>::decode(br) } -> std::same_as<T>;
+  };
+
+  template<typename T>
+    requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+  struct BinaryCodec<T>
+  {
+    using t_unsigned = std::make_unsigned_t<T>;
+    static void encode(BinaryWriter& bw, const T& val) { bw.putUnsigned(static_cast<t_unsigned>(val)); }
+    static T    decode(BinaryReader& br)               { return static_cast<T>(br.getUnsigned<t_unsigned>()); }
+  };
+
+  template<>
+  struct BinaryCodec<bool>
+  {
+    static void encode(BinaryWriter& bw, const bool& val) { bw.putUnsigned(uint8_t(val ? 1 : 0)); }
+    static bool decode(BinaryReader& br)                  { return br.getUnsigned<uint8_t>() != 0; }
+  };
+
+  template<std::floating_point T>
+    requires (sizeof(T) == 4 || sizeof(T) == 8)
+  struct BinaryCodec<T>
+  {
+    using t_unsigned = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    static void encode(BinaryWriter& bw, const T& val)
+    {
+      t_unsigned bits;
+      std::memcpy(&bits, &val, sizeof(T));
+      bw.putUnsigned(bits);
+    }
+    static T decode(BinaryReader& br)
+    {
+      t_unsigned bits = br.getUnsigned<t_unsigned>();
+      T val;
+      std::memcpy(&val, &bits, sizeof(T));
+      return val;
+    }
+  };
+
+  template<typename T>
+    requires std::is_enum_v<T>
+  struct BinaryCodec<T>
+  {
+    using t_underlying = std::underlying_type_t<T>;
+    static void encode(BinaryWriter& bw, const T& val) { BinaryCodec<t_underlying>::encode(bw, static_cast<t_underlying>(val)); }
+    static T    decode(BinaryReader& br)               { return static_cast<T>(BinaryCodec<t_underlying>::decode(br)); }
+  };
+
+  // std::string, ci_string and any other character-traits variant
+  template<typename CharT, typename Traits, typename Alloc>
+    requires (sizeof(CharT) == 1)
+  struct BinaryCodec<std::basic_string<CharT, Traits, Alloc>>
+  {
+    using t_string = std::basic_string<CharT, Traits, Alloc>;
+    static void encode(BinaryWriter& bw, const t_string& val)
+    {
+      bw.putUnsigned(static_cast<uint32_t>(val.size()));
+      bw.putBytes(reinterpret_cast<const char*>(val.data()), val.size());
+    }
+    static t_string decode(BinaryReader& br)
+    {
+      const uint32_t len = br.getUnsigned<uint32_t>();
+      const char* data = br.getBytes(len);
+      return t_string(reinterpret_cast<const CharT*>(data), len);
+    }
+  };
+
+  // std::chrono::year_month_day and its derived formatted types (eg: specializedTypes::format_year_month_day)
+  template<typename T>
+    requires std::derived_from<T, std::chrono::year_month_day>
+  struct BinaryCodec<T>
+  {
+    static void encode(BinaryWriter& bw, const T& val)
+    {
+      bw.putUnsigned(static_cast<uint16_t>(static_cast<int16_t>(int(val.year()))));
+      bw.putUnsigned(static_cast<uint8_t>(unsigned(val.month())));
+      bw.putUnsigned(static_cast<uint8_t>(unsigned(val.day())));
+    }
+    static T decode(BinaryReader& br)
+    {
+      const int      yy = static_cast<int16_t>(br.getUnsigned<uint16_t>());
+      const unsigned mm = br.getUnsigned<uint8_t>();
+      const unsigned dd = br.getUnsigned<uint8_t>();
+      return T{std::chrono::year{yy}, std::chrono::month{mm}, std::chrono::day{dd}};
+    }
+  };
+
+  template<typename K, typename C, typename A>
+  struct BinaryCodec<std::set<K, C, A>>
+  {
+    static void encode(BinaryWriter& bw, const std::set<K, C, A>& val)
+    {
+      bw.putUnsigned(static_cast<uint32_t>(val.size()));
+      for(const K& elem : val)
+        BinaryCodec<K>::encode(bw, elem);
+    }
+    static std::set<K, C, A> decode(BinaryReader& br)
+    {
+      std::set<K, C, A> val;
+      const uint32_t len = br.getUnsigned<uint32_t>();
+      for(uint32_t iii = 0; iii < len; ++iii)
+        val.emplace_hint(val.end(), BinaryCodec<K>::decode(br));
+      return val;
+    }
+  };
+
+  template<typename ... T>
+  struct BinaryCodec<std::tuple<T...>>
+  {
+    static void encode(BinaryWriter& bw, const std::tuple<T...>& val)
+    {
+      std::apply([&bw](const T& ... elem) { (BinaryCodec<T>::encode(bw, elem), ...); }, val);
+    }
+    static std::tuple<T...> decode(BinaryReader& br)
+    {
+      // braced-init-list guarantees left-to-right evaluation of the decode calls
+      return std::tuple<T...>{ BinaryCodec<T>::decode(br) ... };
+    }
+  };
+
+  template<>
+  struct BinaryCodec<StreamerHelper>
+  {
+    static void encode(BinaryWriter& bw, const StreamerHelper& val)
+    {
+      BinaryCodec<char>::encode(bw, val.getDelimiterMetaData());
+      BinaryCodec<char>::encode(bw, val.getDelimiterCSV());
+      BinaryCodec<char>::encode(bw, val.getDelimiterBuildDirection());
+    }
+    static StreamerHelper decode(BinaryReader& br)
+    {
+      const char delimiterMetaData       = BinaryCodec<char>::decode(br);
+      const char delimiterCSV            = BinaryCodec<char>::decode(br);
+      const char delimiterBuildDirection = BinaryCodec<char>::decode(br);
+      return StreamerHelper{delimiterMetaData, delimiterCSV, delimiterBuildDirection};
+    }
+  };
+
+  template<>
+  struct BinaryCodec<MetaDataSource>
+  {
+    static void encode(BinaryWriter& bw, const MetaDataSource& val)
+    {
+      BinaryCodec<t_DataType>::encode(bw, val.getDataType());
+      BinaryCodec<char>::encode(bw, char(val.getBuildDirection()));
+      BinaryCodec<char>::encode(bw, char(val.getModificationPatch()));
+      BinaryCodec<std::set<t_DataType>>::encode(bw, val.getMergedDataTypes());
+      BinaryCodec<StreamerHelper>::encode(bw, val.getStreamerHelper());
+    }
+    static MetaDataSource decode(BinaryReader& br)
+    {
+      const t_DataType         dataType        = BinaryCodec<t_DataType>::decode(br);
+      const eBuildDirection    buildDirection  = char2BuildDirection(BinaryCodec<char>::decode(br));
+      const eModificationPatch dataPatch       = char2ModificationPatch(BinaryCodec<char>::decode(br));
+      const std::set<t_DataType> mergedTypes   = BinaryCodec<std::set<t_DataType>>::decode(br);
+      const StreamerHelper     streamerHelper  = BinaryCodec<StreamerHelper>::decode(br);
+      return MetaDataSource{dataType, buildDirection, dataPatch, mergedTypes, streamerHelper};
+    }
+  };
+
+  // the pooled value is written, decoding interns it again
+  template<typename M>
+  struct BinaryCodec<InternedMetaData<M>>
+  {
+    static void encode(BinaryWriter& bw, const InternedMetaData<M>& val)
+    {
+      BinaryCodec<M>::encode(bw, val.get());
+    }
+    static InternedMetaData<M> decode(BinaryReader& br)
+    {
+      return InternedMetaData<M>{BinaryCodec<M>::decode(br)};
+    }
+  };
+
+  template<typename ... MT>
+  struct BinaryCodec<DataSet<MT...>>
+  {
+    using t_dataset = DataSet<MT...>;
+    using t_record  = typename t_dataset::t_record;
+
+    static void encode(BinaryWriter& bw, const t_dataset& val)
+    {
+      if constexpr(t_dataset::hasMetaData())
+        BinaryCodec<typename t_dataset::t_metaData>::encode(bw, val.getMetaData());
+      BinaryCodec<t_record>::encode(bw, val.getRecord());
+    }
+    static t_dataset decode(BinaryReader& br)
+    {
+      if constexpr(t_dataset::hasMetaData())
+      {
+        const auto     metaData = BinaryCodec<typename t_dataset::t_metaData>::decode(br);
+        const t_record record   = BinaryCodec<t_record>::decode(br);
+        return t_dataset{metaData, record};
+      } else {
+        return t_dataset{BinaryCodec<t_record>::decode(br)};
+      }
+    }
+  };
+
+  /*
+   * only user supplied ChangesInDataSet's (i.e. elements marked DELTACHANGE or FullRECORD) are encodable.
+   * ChangesInDataSet's with SNAPSHOT elements are internal to VersionedObjectBuilder.
+   */
+  template<typename M, typename ... T>
+  struct BinaryCodec<ChangesInDataSet<M, T...>>
+  {
+    using t_changes = ChangesInDataSet<M, T...>;
+    using t_record  = typename t_changes::t_record;
+    static constexpr size_t t_size = std::tuple_size_v<t_record>;
+
+    static void encode(BinaryWriter& bw, const t_changes& val)
+    {
+      for(const eModificationPatch patch : val.getModifiedIndexes())
+      {
+        if(patch == eModificationPatch::SNAPSHOT)
+        {
+          throw VO_Codec_exception("ERROR : BinaryCodec<ChangesInDataSet<...>>::encode() : SNAPSHOT element cannot be encoded");
+        }
+        BinaryCodec<bool>::encode(bw, patch == eModificationPatch::DELTACHANGE);
+      }
+      if constexpr(c_MetaData<M>)
+        BinaryCodec<M>::encode(bw, val.getMetaData());
+      else
+        BinaryCodec<char>::encode(bw, char(val.getBuildDirection()));
+      BinaryCodec<t_record>::encode(bw, val.getOldRecord());
+      BinaryCodec<t_record>::encode(bw, val.getNewRecord());
+    }
+    static t_changes decode(BinaryReader& br)
+    {
+      std::array<bool, t_size> modifiedElements;
+      for(bool& flag : modifiedElements)
+        flag = BinaryCodec<bool>::decode(br);
+      if constexpr(c_MetaData<M>)
+      {
+        const M        metaData  = BinaryCodec<M>::decode(br);
+        const t_record oldValues = BinaryCodec<t_record>::decode(br);
+        const t_record newValues = BinaryCodec<t_record>::decode(br);
+        return t_changes{modifiedElements, oldValues, newValues, metaData};
+      } else {
+        const eBuildDirection buildDirection = char2BuildDirection(BinaryCodec<char>::decode(br));
+        const t_record oldValues = BinaryCodec<t_record>::decode(br);
+        const t_record newValues = BinaryCodec<t_record>::decode(br);
+        return t_changes{modifiedElements, oldValues, newValues, buildDirection};
+      }
+    }
+  };
+
+  template<typename M, typename ... T>
+  struct BinaryCodec<SnapshotDataSet<M, T...>>
+  {
+    using t_snapshot = SnapshotDataSet<M, T...>;
+    using t_record   = typename t_snapshot::t_record;
+    static constexpr size_t t_size = std::tuple_size_v<t_record>;
+
+    static void encode(BinaryWriter& bw, const t_snapshot& val)
+    {
+      for(const eModificationPatch patch : val.getModifiedIndexes())
+        BinaryCodec<bool>::encode(bw, patch == eModificationPatch::SNAPSHOT);
+      if constexpr(c_MetaData<M>)
+        BinaryCodec<M>::encode(bw, val.getMetaData());
+      BinaryCodec<t_record>::encode(bw, val.getNewRecord());
+    }
+    static t_snapshot decode(BinaryReader& br)
+    {
+      std::array<bool, t_size> modifiedElements;
+      for(bool& flag : modifiedElements)
+        flag = BinaryCodec<bool>::decode(br);
+      if constexpr(c_MetaData<M>)
+      {
+        const M        metaData       = BinaryCodec<M>::decode(br);
+        const t_record snapshotValues = BinaryCodec<t_record>::decode(br);
+        return t_snapshot{modifiedElements, snapshotValues, metaData};
+      } else {
+        return t_snapshot{modifiedElements, BinaryCodec<t_record>::decode(br)};
+      }
+    }
+  };
+
+  // [u32 versionCount] { [versionDate][DataSet] } ...   in ascending date order
+  template<typename VDT, typename ... MT>
+  struct BinaryCodec<VersionedObject<VDT, MT...>>
+  {
+    using t_versionedObject = VersionedObject<VDT, MT...>;
+    using t_dataset         = typename t_versionedObject::t_dataset;
+
+    static void encode(BinaryWriter& bw, const t_versionedObject& val)
+    {
+      const auto& ledger = val.getDatasetLedger();
+      bw.putUnsigned(static_cast<uint32_t>(ledger.size()));
+      for(const auto& [versionDate, dataset] : ledger)
+      {
+        BinaryCodec<VDT>::encode(bw, versionDate);
+        BinaryCodec<t_dataset>::encode(bw, dataset);
+      }
+    }
+    static t_versionedObject decode(BinaryReader& br)
+    {
+      t_versionedObject vo;
+      decodeInto(br, vo);
+      return vo;
+    }
+    static void decodeInto(BinaryReader& br, t_versionedObject& vo)
+    {
+      const uint32_t versionCount = br.getUnsigned<uint32_t>();
+      for(uint32_t iii = 0; iii < versionCount; ++iii)
+      {
+        const VDT       versionDate = BinaryCodec<VDT>::decode(br);
+        const t_dataset dataset     = BinaryCodec<t_dataset>::decode(br);
+        vo.insertVersion(versionDate, dataset);
+      }
+    }
+  };
+
+  template<typename T>
+  inline void binaryEncode(std::string& buffer, const T& val)
+  {
+    BinaryWriter bw{buffer};
+    BinaryCodec<T>::encode(bw, val);
+  }
+
+  template<typename T>
+  inline T binaryDecode(BinaryReader& br)
+  {
+    return BinaryCodec<T>::decode(br);
+  }
+
+  // FNV-1a : used to detect torn/corrupt records
+  inline uint32_t checksumFNV1a(const char* data, size_t len)
+  {
+    uint32_t hash = 2166136261u;
+    for(size_t iii = 0; iii < len; ++iii)
+    {
+      hash ^= static_cast<uint8_t>(data[iii]);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
+} }   //  namespace datastructure::versionedObject
@@ -0,0 +1,563 @@
+/*
+ * VersionedObjectJournal.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <functional>
+#include <filesystem>
+#include <system_error>
+#include <condition_variable>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/VersionedObjectBuilder.h>
+#include <versionedObject/VersionedObjectCodec.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  using VO_Journal_IO_exception = VO_exception<12>;
+
+  enum eJournalRecord : uint8_t {
+    INSERT_DELTA     = 1,   //  VersionedObjectBuilder::insertDeltaVersion()
+    INSERT_SNAPSHOT  = 2,   //  VersionedObjectBuilder::insertSnapshotVersion()
+    INSERT_VERSION   = 3    //  VersionedObject::insertVersion()
+  };
+
+  struct JournalReplayResult
+  {
+    size_t    records          = 0;      // number of valid records replayed
+    uintmax_t validBytes       = 0;      // file offset upto which records are valid
+    bool      isTailTruncated  = false;  // true if a torn/corrupt record was found at the tail
+  };
+
+  /*
+   * Append-only journal of insert calls on VersionedObjectBuilder and VersionedObject.
+   *
+   * file-layout :   MAGIC { [u32 length][payload][u32 checksum] } ...
+   *       payload : [u8 eJournalRecord][objectKey][versionDate][ChangesInDataSet | SnapshotDataSet | DataSet]
+   *
+   * Records are buffered in memory and written with a single write+fsync per group
+   * (group commit) : once 'groupCommitSize' records are pending, or when the oldest pending
+   * record is 'maxCommitDelay' old ( zero : no delay bound ). The thread that triggers a group
+   * leads it, writing and syncing outside the lock while the other threads keep appending.
+   * commit() can be called explicitly at any time to force the pending group to disk;
+   * destructor commits the remainder. A record is durable only after the commit covering it has returned.
+   * A failed commit truncates the journal back to the last durable record, and the journal
+   * then refuses further records.
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectJournal
+  {
+  public:
+    using t_versionDate         = VDT;
+    using t_versionedObject     = VersionedObject<VDT, MT...>;
+    using t_versionedObjectBuilder = VersionedObjectBuilder<VDT, MT...>;
+    using t_dataset             = DataSet<MT...>;
+    using t_changesInDataSet    = ChangesInDataSet<MT...>;
+    using t_snapshotDataSet     = SnapshotDataSet<MT...>;
+
+    using t_onDelta    = std::function<void(const std::string&, const VDT&, const t_changesInDataSet&)>;
+    using t_onSnapshot = std::function<void(const std::string&, const VDT&, const t_snapshotDataSet&)>;
+    using t_onVersion  = std::function<void(const std::string&, const VDT&, const t_dataset&)>;
+
+    inline static const std::string MAGIC{"VOJRNL01"};
+
+    VersionedObjectJournal(const std::filesystem::path& journalPath,
+                           size_t groupCommitSize = 64,
+                           std::chrono::milliseconds maxCommitDelay = std::chrono::milliseconds{10})
+      : _journalPath(journalPath),
+        _groupCommitSize(groupCommitSize == 0 ? 1 : groupCommitSize),
+        _maxCommitDelay(maxCommitDelay),
+        _pendingBuffer(),
+        _flushBuffer(),
+        _pendingRecords(0),
+        _appendedRecords(0),
+        _durableRecords(0),
+        _committedBytes(0),
+        _pendingSince(),
+        _isFlushing(false),
+        _isPoisoned(false),
+        _isStopping(false),
+        _file(nullptr),
+        _mutex(),
+        _stateChanged(),
+        _delayFlusher()
+    {
+      bool writeMagic = true;
+      if(std::filesystem::exists(_journalPath) && std::filesystem::file_size(_journalPath) > 0)
+      {
+        // recover from a torn tail left behind by a crash during the last commit
+        const JournalReplayResult scan = _scan(_journalPath, nullptr, nullptr, nullptr);
+        if(scan.isTailTruncated)
+        {
+          VERSIONEDOBJECT_DEBUG_LOG("DEBUG_LOG:  VersionedObjectJournal() : truncating torn tail of journal to " << scan.validBytes << " bytes");
+          std::filesystem::resize_file(_journalPath, scan.validBytes);
+        }
+        _committedBytes = scan.validBytes;
+        writeMagic = false;
+      }
+
+      _file = std::fopen(_journalPath.string().c_str(), "ab");
+      if(_file == nullptr)
+      {
+        throw VO_Journal_IO_exception("ERROR : VersionedObjectJournal() : unable to open journal '" + _journalPath.string() + "'");
+      }
+      // unbuffered : each group is a single fwrite, and nothing is left behind in the FILE after a failed one
+      std::setvbuf(_file, nullptr, _IONBF, 0);
+      if(writeMagic)
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _pendingBuffer.append(MAGIC);
+        try {
+          _leadFlush(lock);
+        } catch (...) {
+          std::fclose(_file);
+          throw;
+        }
+      }
+      if(_maxCommitDelay.count() > 0)
+      {
+        _delayFlusher = std::thread(&VersionedObjectJournal::_flushOnDelay, this);
+      }
+    }
+
+    VersionedObjectJournal() = delete;
+    VersionedObjectJournal(VersionedObjectJournal const&) = delete;
+    VersionedObjectJournal& operator=(VersionedObjectJournal const&) = delete;
+
+    virtual ~VersionedObjectJournal()
+    {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+      }
+      _stateChanged.notify_all();
+      if(_delayFlusher.joinable())
+      {
+        _delayFlusher.join();
+      }
+      try {
+        commit();
+      } catch (const std::exception& err) {
+        VERSIONEDOBJECT_DEBUG_LOG("ERROR : ~VersionedObjectJournal() : " << err.what());
+      }
+      std::fclose(_file);
+    }
+
+    inline void appendDelta(const std::string& objectKey, const VDT& forDate, const t_changesInDataSet& chgEntry)
+    {
+      _append(eJournalRecord::INSERT_DELTA, objectKey, forDate, chgEntry);
+    }
+
+    inline void appendSnapshot(const std::string& objectKey, const VDT& forDate, const t_snapshotDataSet& snpEntry)
+    {
+      _append(eJournalRecord::INSERT_SNAPSHOT, objectKey, forDate, snpEntry);
+    }
+
+    inline void appendVersion(const std::string& objectKey, const VDT& forDate, const t_dataset& newEntry)
+    {
+      _append(eJournalRecord::INSERT_VERSION, objectKey, forDate, newEntry);
+    }
+
+    // returns once every record appended before the call is durable
+    inline void commit()
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      const uint64_t commitRecords = _appendedRecords;
+      while(_durableRecords < commitRecords)
+      {
+        _throwIfPoisoned();
+        if(_isFlushing)
+        {
+          _stateChanged.wait(lock);   // the running group may not cover all of them, re-check
+        } else {
+          _leadFlush(lock);
+        }
+      }
+    }
+
+    inline size_t getPendingRecords() const
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      return _pendingRecords;
+    }
+    inline const std::filesystem::path& getJournalPath() const { return _journalPath; }
+
+    static JournalReplayResult replay(const std::filesystem::path& journalPath,
+                                      const t_onDelta&    onDelta,
+                                      const t_onSnapshot& onSnapshot,
+                                      const t_onVersion&  onVersion)
+    {
+      return _scan(journalPath, &onDelta, &onSnapshot, &onVersion);
+    }
+
+    // rebuilds the in-memory state, keyed by objectKey. Builder-records are re-applied
+    // to 'builders' and VersionedObject-records to 'versionedObjects', in journal order.
+    static JournalReplayResult replay(const std::filesystem::path& journalPath,
+                                      std::map<std::string, t_versionedObjectBuilder>& builders,
+                                      std::map<std::string, t_versionedObject>& versionedObjects)
+    {
+      const t_onDelta onDelta = [&builders](const std::string& objectKey, const VDT& forDate, const t_changesInDataSet& chgEntry)
+      {
+        builders[objectKey].insertDeltaVersion(forDate, chgEntry);
+      };
+      const t_onSnapshot onSnapshot = [&builders](const std::string& objectKey, const VDT& forDate, const t_snapshotDataSet& snpEntry)
+      {
+        builders[objectKey].insertSnapshotVersion(forDate, snpEntry);
+      };
+      const t_onVersion onVersion = [&versionedObjects](const std::string& objectKey, const VDT& forDate, const t_dataset& newEntry)
+      {
+        versionedObjects[objectKey].insertVersion(forDate, newEntry);
+      };
+      return _scan(journalPath, &onDelta, &onSnapshot, &onVersion);
+    }
+
+  private:
+    using t_clock = std::chrono::steady_clock;
+
+    const std::filesystem::path      _journalPath;
+    const size_t                     _groupCommitSize;
+    const std::chrono::milliseconds  _maxCommitDelay;
+    std::string                      _pendingBuffer;
+    std::string                      _flushBuffer;      // the group being written, owned by the leader
+    size_t                           _pendingRecords;
+    uint64_t                         _appendedRecords;  // since the journal was opened
+    uint64_t                         _durableRecords;
+    uintmax_t                        _committedBytes;   // journal size upto the last durable record
+    t_clock::time_point              _pendingSince;     // when the oldest pending record was appended
+    bool                             _isFlushing;
+    bool                             _isPoisoned;
+    bool                             _isStopping;
+    std::FILE*                       _file;
+    mutable std::mutex               _mutex;
+    std::condition_variable          _stateChanged;
+    std::thread                      _delayFlusher;
+
+    template<typename ENTRY>
+    inline void _append(eJournalRecord recordType, const std::string& objectKey, const VDT& forDate, const ENTRY& entry)
+    {
+      // encode outside the lock; a failed encode leaves no partial record behind
+      std::string payload;
+      BinaryWriter bw{payload};
+      BinaryCodec<uint8_t>::encode(bw, recordType);
+      BinaryCodec<std::string>::encode(bw, objectKey);
+      BinaryCodec<VDT>::encode(bw, forDate);
+      BinaryCodec<ENTRY>::encode(bw, entry);
+
+      std::string frame;
+      BinaryWriter fw{frame};
+      fw.putUnsigned(static_cast<uint32_t>(payload.size()));
+      fw.putBytes(payload.data(), payload.size());
+      fw.putUnsigned(checksumFNV1a(payload.data(), payload.size()));
+
+      std::unique_lock<std::mutex> lock(_mutex);
+      _throwIfPoisoned();
+      _pendingBuffer.append(frame);
+      ++_appendedRecords;
+      if(_pendingRecords++ == 0)
+      {
+        _pendingSince = t_clock::now();
+        _stateChanged.notify_all();   // starts the delay of _flushOnDelay()
+      }
+      // a group filled up while another one was being written is led on return
+      while(_pendingRecords >= _groupCommitSize && !_isFlushing)
+      {
+        _leadFlush(lock);
+      }
+    }
+
+    inline void _throwIfPoisoned() const
+    {
+      if(_isPoisoned)
+      {
+        throw VO_Journal_IO_exception("ERROR : VersionedObjectJournal : an earlier commit failed, no more records accepted for '" + _journalPath.string() + "'");
+      }
+    }
+
+    /*
+     * called with 'lock' held and no group being written. Takes the pending records as the group,
+     * writes and syncs it with 'lock' released, and returns with 'lock' held again.
+     * On a failure the journal is truncated back to '_committedBytes' and poisoned.
+     */
+    void _leadFlush(std::unique_lock<std::mutex>& lock)
+    {
+      _isFlushing = true;
+      _pendingBuffer.swap(_flushBuffer);
+      _pendingRecords = 0;
+      const uint64_t groupRecords = _appendedRecords;
+      lock.unlock();
+
+      const size_t groupBytes = _flushBuffer.size();
+      std::string errMsg = _writeAndSync(_flushBuffer);
+      _flushBuffer.clear();
+      if(!errMsg.empty())
+      {
+        std::error_code ec;
+        std::filesystem::resize_file(_journalPath, _committedBytes, ec);
+        if(ec)
+        {
+          errMsg += " ; truncate back to " + std::to_string(_committedBytes) + " bytes failed : " + ec.message();
+        }
+      }
+
+      lock.lock();
+      _isFlushing = false;
+      if(errMsg.empty())
+      {
+        _committedBytes += groupBytes;
+        _durableRecords = groupRecords;
+      } else {
+        _isPoisoned = true;
+      }
+      _stateChanged.notify_all();
+      if(!errMsg.empty())
+      {
+        throw VO_Journal_IO_exception(errMsg);
+      }
+    }
+
+    // returns the error message, empty on success
+    inline std::string _writeAndSync(const std::string& group) const
+    {
+      if(group.empty())
+        return std::string{};
+
+      if(std::fwrite(group.data(), 1, group.size(), _file) != group.size() ||
+         std::fflush(_file) != 0)
+      {
+        return "ERROR : VersionedObjectJournal::commit() : write failed for '" + _journalPath.string() + "'";
+      }
+#ifndef _WIN32
+      const int syncResult = ::fsync(::fileno(_file));
+#else
+      const int syncResult = ::_commit(::_fileno(_file));
+#endif
+      if(syncResult != 0)
+      {
+        return "ERROR : VersionedObjectJournal::commit() : fsync failed for '" + _journalPath.string() + "'";
+      }
+      return std::string{};
+    }
+
+    // commits the pending group once its oldest record is '_maxCommitDelay' old
+    void _flushOnDelay()
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      while(!_isStopping)
+      {
+        if(_pendingRecords == 0 || _isFlushing || _isPoisoned)
+        {
+          _stateChanged.wait(lock);
+        } else if(t_clock::now() < _pendingSince + _maxCommitDelay) {
+          _stateChanged.wait_until(lock, _pendingSince + _maxCommitDelay);
+        } else {
+          try {
+            _leadFlush(lock);
+          } catch (const VO_Journal_IO_exception& err) {
+            // the journal is poisoned : the next append or commit() reports the failure
+            VERSIONEDOBJECT_DEBUG_LOG("ERROR : VersionedObjectJournal::_flushOnDelay() : " << err.what());
+          }
+        }
+      }
+    }
+
+    static JournalReplayResult _scan(const std::filesystem::path& journalPath,
+                                     const t_onDelta*    onDelta,
+                                     const t_onSnapshot* onSnapshot,
+                                     const t_onVersion*  onVersion)
+    {
+      std::ifstream ifs(journalPath, std::ios::binary);
+      if(!ifs)
+      {
+        throw VO_Journal_IO_exception("ERROR : VersionedObjectJournal::replay() : unable to open journal '" + journalPath.string() + "'");
+      }
+      const std::string content{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+
+      JournalReplayResult result;
+      if(content.size() < MAGIC.size() || content.compare(0, MAGIC.size(), MAGIC) != 0)
+      {
+        throw VO_Journal_IO_exception("ERROR : VersionedObjectJournal::replay() : '" + journalPath.string() + "' is not a journal file");
+      }
+      result.validBytes = MAGIC.size();
+
+      BinaryReader br{content.data() + MAGIC.size(), content.size() - MAGIC.size()};
+      while(br.remaining() > 0)
+      {
+        if(br.remaining() < 2*sizeof(uint32_t))
+        {
+          result.isTailTruncated = true;
+          break;
+        }
+        const uint32_t payloadLen = br.getUnsigned<uint32_t>();
+        if(br.remaining() < size_t(payloadLen) + sizeof(uint32_t))
+        {
+          result.isTailTruncated = true;
+          break;
+        }
+        const char* payload = br.getBytes(payloadLen);
+        if(br.getUnsigned<uint32_t>() != checksumFNV1a(payload, payloadLen))
+        {
+          if(br.remaining() > 0)   // not a torn tail : records were committed after it
+          {
+            throw VO_Journal_IO_exception("ERROR : VersionedObjectJournal::replay() : corrupt record at offset " +
+                                          std::to_string(result.validBytes) + " of '" + journalPath.string() + "'");
+          }
+          result.isTailTruncated = true;
+          break;
+        }
+
+        if(onDelta != nullptr)
+        {
+          BinaryReader pr{payload, payloadLen};
+          const uint8_t     recordType = BinaryCodec<uint8_t>::decode(pr);
+          const std::string objectKey  = BinaryCodec<std::string>::decode(pr);
+          const VDT         forDate    = BinaryCodec<VDT>::decode(pr);
+          switch(recordType)
+          {
+          case eJournalRecord::INSERT_DELTA :
+            (*onDelta)(objectKey, forDate, BinaryCodec<t_changesInDataSet>::decode(pr));
+            break;
+          case eJournalRecord::INSERT_SNAPSHOT :
+            (*onSnapshot)(objectKey, forDate, BinaryCodec<t_snapshotDataSet>::decode(pr));
+            break;
+          case eJournalRecord::INSERT_VERSION :
+            (*onVersion)(objectKey, forDate, BinaryCodec<t_dataset>::decode(pr));
+            break;
+          default:
+            throw VO_Codec_exception("ERROR : VersionedObjectJournal::replay() : unknown record type " + std::to_string(recordType));
+          }
+        }
+        ++result.records;
+        result.validBytes += 2*sizeof(uint32_t) + payloadLen;
+      }
+      return result;
+    }
+  };
+
+
+  /*
+   * write-through wrappers : every successful insert is appended to the journal.
+   * Calls that throw are not journaled and leave the builder/object unchanged,
+   * so replay re-applies exactly the accepted calls.
+   */
+  template <typename VDT, typename ... MT>
+  class JournaledVersionedObjectBuilder
+  {
+  public:
+    using t_journal = VersionedObjectJournal<VDT, MT...>;
+    using t_versionedObjectBuilder = VersionedObjectBuilder<VDT, MT...>;
+
+    JournaledVersionedObjectBuilder(t_versionedObjectBuilder& builder, t_journal& journal, const std::string& objectKey)
+      : _builder(builder), _journal(journal), _objectKey(objectKey)
+    {}
+
+    inline bool insertDeltaVersion(const VDT& forDate, const ChangesInDataSet<MT...>& chgEntry)
+    {
+      t_versionsAt undoVersions = _copyVersionsAt(forDate);
+      try {
+        const bool result = _builder.insertDeltaVersion(forDate, chgEntry);
+        _journal.appendDelta(_objectKey, forDate, chgEntry);
+        return result;
+      } catch (...) {
+        _builder.resetVersionsAt(forDate, std::move(undoVersions.first), std::move(undoVersions.second));
+        throw;
+      }
+    }
+
+    inline bool insertSnapshotVersion(const VDT& forDate, const SnapshotDataSet<MT...>& snpEntry)
+    {
+      t_versionsAt undoVersions = _copyVersionsAt(forDate);
+      try {
+        const bool result = _builder.insertSnapshotVersion(forDate, snpEntry);
+        _journal.appendSnapshot(_objectKey, forDate, snpEntry);
+        return result;
+      } catch (...) {
+        _builder.resetVersionsAt(forDate, std::move(undoVersions.first), std::move(undoVersions.second));
+        throw;
+      }
+    }
+
+    inline t_versionedObjectBuilder& getBuilder() { return _builder; }
+    inline const std::string& getObjectKey() const { return _objectKey; }
+
+  private:
+    using t_versionsAt = std::pair< typename t_versionedObjectBuilder::t_deltaEntriesMap,
+                                    typename t_versionedObjectBuilder::t_snapShotEntriesMap >;
+
+    // the entries an insert on 'forDate' may change, copied before it to undo it
+    inline t_versionsAt _copyVersionsAt(const VDT& forDate) const
+    {
+      t_versionsAt versionsAt;
+      const auto deltaIter = _builder.getDeltaChangeMap().find(forDate);
+      if(deltaIter != _builder.getDeltaChangeMap().cend())
+      {
+        versionsAt.first.insert(*deltaIter);
+      }
+      const auto snapShotRange = _builder.getSnapShotMap().equal_range(forDate);
+      versionsAt.second.insert(snapShotRange.first, snapShotRange.second);
+      return versionsAt;
+    }
+
+    t_versionedObjectBuilder&  _builder;
+    t_journal&                 _journal;
+    const std::string          _objectKey;
+  };
+
+  template <typename VDT, typename ... MT>
+  class JournaledVersionedObject
+  {
+  public:
+    using t_journal = VersionedObjectJournal<VDT, MT...>;
+    using t_versionedObject = VersionedObject<VDT, MT...>;
+
+    JournaledVersionedObject(t_versionedObject& vo, t_journal& journal, const std::string& objectKey)
+      : _vo(vo), _journal(journal), _objectKey(objectKey)
+    {}
+
+    // journaled before it is applied : once 'forDate' is known to be new, only an allocation failure can reject it
+    inline bool insertVersion(const VDT& forDate, const DataSet<MT...>& newEntry)
+    {
+      if(_vo.getDatasetLedger().contains(forDate))
+      {
+        // an identical existing record is a no-op, a different one throws : nothing to journal
+        return _vo.insertVersion(forDate, newEntry);
+      }
+      _journal.appendVersion(_objectKey, forDate, newEntry);
+      return _vo.insertVersion(forDate, newEntry);
+    }
+
+    inline t_versionedObject& getVersionedObject() { return _vo; }
+    inline const std::string& getObjectKey() const { return _objectKey; }
+
+  private:
+    t_versionedObject&  _vo;
+    t_journal&          _journal;
+    const std::string   _objectKey;
+  };
+
+} }   //  namespace datastructure::versionedObject
@@ -0,0 +1,93 @@
+/*
+ * VersionedObjectParallel.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+
+
+namespace datastructure { namespace versionedObject
+{
+  // 0 -> one thread per hardware core
+  inline size_t resolveThreadCount(size_t threadCount)
+  {
+    if(threadCount == 0)
+    {
+      threadCount = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(threadCount, 1);
+  }
+
+  /*
+   * calls fn(chunkIdx, beginIdx, endIdx) for contiguous chunks covering [0, count).
+   * Chunks are handed out dynamically to 'threadCount' workers; the chunk boundaries
+   * depend only on 'count' and 'chunkCount', so results collected per chunk can be
+   * stitched back in index order deterministically.
+   * The first exception thrown by any fn() is rethrown in the caller after all workers join.
+   */
+  template<typename FN>
+  void parallelForChunks(size_t count, size_t chunkCount, size_t threadCount, FN&& fn)
+  {
+    if(count == 0)
+      return;
+    chunkCount  = std::clamp<size_t>(chunkCount, 1, count);
+    threadCount = std::min(resolveThreadCount(threadCount), chunkCount);
+
+    const size_t chunkSize = count / chunkCount;
+    const size_t remainder = count % chunkCount;
+    auto chunkBegin = [chunkSize, remainder](size_t chunkIdx)
+    {
+      return chunkIdx * chunkSize + std::min(chunkIdx, remainder);
+    };
+
+    std::atomic<size_t>   nextChunk{0};
+    std::exception_ptr    firstError;
+    std::mutex            errorMutex;
+    auto worker = [&]()
+    {
+      for(size_t chunkIdx = nextChunk++; chunkIdx < chunkCount; chunkIdx = nextChunk++)
+      {
+        try {
+          fn(chunkIdx, chunkBegin(chunkIdx), chunkBegin(chunkIdx + 1));
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(errorMutex);
+          if(!firstError)
+            firstError = std::current_exception();
+          nextChunk = chunkCount;  // stop handing out further chunks
+        }
+      }
+    };
+
+    if(threadCount == 1)
+    {
+      worker();
+    } else {
+      std::vector<std::thread> workers;
+      workers.reserve(threadCount - 1);
+      for(size_t iii = 1; iii < threadCount; ++iii)
+        workers.emplace_back(worker);
+      worker();  // calling thread participates
+      for(std::thread& th : workers)
+        th.join();
+    }
+
+    if(firstError)
+      std::rethrow_exception(firstError);
+  }
+
+} }   //  namespace datastructure::versionedObject
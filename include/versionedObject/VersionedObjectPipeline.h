@@ -0,0 +1,504 @@
+/*
+ * VersionedObjectPipeline.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <set>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <istream>
+#include <sstream>
+#include <variant>
+#include <optional>
+#include <exception>
+#include <functional>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/SnapshotDataSet.h>
+#include <versionedObject/ChangesInDataSet.h>
+#include <versionedObject/VersionedObjectBuilder.h>
+#include <versionedObject/VersionedObjectStream.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  using VO_Pipeline_exception = VO_exception<14>;
+
+  /*
+   * bounded lock-free single-producer/single-consumer queue.
+   * capacity is rounded up to a power of 2.
+   * waitUntil() is the blocking slow path of either side; push, pop and close wake it.
+   */
+  template<typename T>
+  class SpscRingBuffer
+  {
+  public:
+    explicit SpscRingBuffer(size_t capacity)
+      : _mask(_roundUpPow2(capacity) - 1),
+        _slots(_mask + 1),
+        _head(0),
+        _tail(0),
+        _closed(false),
+        _waiters(0),
+        _waitMutex(),
+        _waitCv()
+    {}
+
+    SpscRingBuffer() = delete;
+    SpscRingBuffer(SpscRingBuffer const&) = delete;
+    SpscRingBuffer& operator=(SpscRingBuffer const&) = delete;
+
+    // producer side : 'val' is moved-from only on success
+    inline bool tryPush(T&& val)
+    {
+      const size_t tail = _tail.load(std::memory_order_relaxed);
+      if(tail - _head.load(std::memory_order_acquire) > _mask)
+        return false;  // full
+      _slots[tail & _mask].emplace(std::move(val));
+      _tail.store(tail + 1, std::memory_order_release);
+      _wakeWaiters();
+      return true;
+    }
+
+    // consumer side
+    inline std::optional<T> tryPop()
+    {
+      const size_t head = _head.load(std::memory_order_relaxed);
+      if(head == _tail.load(std::memory_order_acquire))
+        return std::nullopt;  // empty
+      std::optional<T>& slot = _slots[head & _mask];
+      std::optional<T> val{std::move(*slot)};
+      slot.reset();
+      _head.store(head + 1, std::memory_order_release);
+      _wakeWaiters();
+      return val;
+    }
+
+    // producer signals end of stream
+    inline void close()
+    {
+      _closed.store(true, std::memory_order_release);
+      _wakeWaiters();
+    }
+
+    inline bool isFull() const
+    {
+      return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire) > _mask;
+    }
+
+    inline bool isEmpty() const
+    {
+      return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+    inline bool isClosed() const { return _closed.load(std::memory_order_acquire); }
+
+    // blocks until 'isReady()' holds, or for at most 'timeout' ( which bounds a missed wake-up )
+    template<typename PRED>
+    inline void waitUntil(PRED&& isReady, std::chrono::microseconds timeout)
+    {
+      std::unique_lock<std::mutex> lock(_waitMutex);
+      _waiters.fetch_add(1);
+      std::atomic_thread_fence(std::memory_order_seq_cst);   // pairs with the fence in _wakeWaiters()
+      _waitCv.wait_for(lock, timeout, std::forward<PRED>(isReady));
+      _waiters.fetch_sub(1);
+    }
+
+    // consumer : true once the producer has closed and every item has been popped
+    inline bool isDrained() const
+    {
+      return _closed.load(std::memory_order_acquire) &&
+             _head.load(std::memory_order_relaxed) == _tail.load(std::memory_order_acquire);
+    }
+
+    inline size_t capacity() const { return _mask + 1; }
+
+  private:
+    const size_t                    _mask;
+    std::vector<std::optional<T>>   _slots;
+    alignas(64) std::atomic<size_t> _head;     // consumer owned
+    alignas(64) std::atomic<size_t> _tail;     // producer owned
+    alignas(64) std::atomic<bool>   _closed;
+    alignas(64) std::atomic<unsigned> _waiters;
+    std::mutex                      _waitMutex;
+    std::condition_variable         _waitCv;
+
+    inline void _wakeWaiters()
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(_waiters.load(std::memory_order_relaxed) > 0)
+      {
+        std::lock_guard<std::mutex> lock(_waitMutex);
+        _waitCv.notify_all();
+      }
+    }
+
+    static size_t _roundUpPow2(size_t val)
+    {
+      size_t pow2 = 2;
+      while(pow2 < val)
+        pow2 <<= 1;
+      return pow2;
+    }
+  };
+
+
+  struct PipelineStageMetrics
+  {
+    std::string               stageName;
+    size_t                    itemsIn     = 0;
+    size_t                    itemsOut    = 0;
+    std::chrono::nanoseconds  busyTime    {0};   // time spent doing the stage's own work
+    std::chrono::nanoseconds  stallTime   {0};   // backpressure : waiting on a full downstream queue
+    std::chrono::nanoseconds  starveTime  {0};   // waiting on an empty upstream queue
+
+    explicit PipelineStageMetrics(const std::string& name = "") : stageName(name) {}
+
+    // items processed per second of wall-clock time of the whole run
+    inline double throughput(std::chrono::nanoseconds wallTime) const
+    {
+      return wallTime.count() > 0 ? double(itemsIn) * 1e9 / double(wallTime.count()) : 0.0;
+    }
+  };
+
+  /*
+   * Pipelined ingestion :   parse -> group -> insert -> build -> export
+   *
+   *   parse   : input line -> t_parsedRow ( objectKey, versionDate, delta | snapshot | record ),  user supplied 't_parser'
+   *   group   : consecutive rows of the same objectKey are collected into one group.
+   *             Input has to be clustered by objectKey; a key re-appearing after its group is closed is an error.
+   *   insert  : insertDeltaVersion / insertSnapshotVersion on a fresh builder, insertVersion on a fresh VersionedObject
+   *   build   : user supplied 't_build', e.g. builder.buildForwardTimeline(vo)
+   *   export  : user supplied 't_export', e.g. csvExporter()
+   *
+   * Every stage runs on its own thread; stages are connected by bounded SpscRingBuffer's.
+   * A stage facing a full downstream queue (backpressure), or an empty upstream one, spins briefly
+   * and then blocks on the queue until it is woken, so an idle pipeline does not keep its cores busy.
+   * At most 'queueCapacity' items are in flight between any two stages.
+   * Objects reach the export stage in input order.
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectPipeline
+  {
+  public:
+    using t_versionDate            = VDT;
+    using t_versionedObject        = VersionedObject<VDT, MT...>;
+    using t_versionedObjectBuilder = VersionedObjectBuilder<VDT, MT...>;
+    using t_dataset                = DataSet<MT...>;
+    using t_changesInDataSet       = ChangesInDataSet<MT...>;
+    using t_snapshotDataSet        = SnapshotDataSet<MT...>;
+
+    struct t_parsedRow
+    {
+      std::string  objectKey;
+      VDT          versionDate;
+      std::variant<t_changesInDataSet, t_snapshotDataSet, t_dataset>  entry;
+    };
+
+    // returning std::nullopt skips the line (eg: header, comment)
+    using t_parser = std::function<std::optional<t_parsedRow>(const std::string&)>;
+    using t_build  = std::function<void(const std::string&, t_versionedObjectBuilder&, t_versionedObject&)>;
+    using t_export = std::function<void(const std::string&, const t_versionedObject&)>;
+
+    enum eStage : size_t { PARSE = 0, GROUP, INSERT, BUILD, EXPORT, STAGE_COUNT };
+
+    VersionedObjectPipeline(const t_parser& parser, const t_build& build, const t_export& exporter,
+                            size_t queueCapacity = 1024)
+      : _parser(parser), _build(build), _exporter(exporter),
+        _queueCapacity(queueCapacity),
+        _metrics(), _wallTime(0),
+        _abort(false), _firstError(), _errorMutex()
+    {}
+
+    VersionedObjectPipeline() = delete;
+    VersionedObjectPipeline(VersionedObjectPipeline const&) = delete;
+    VersionedObjectPipeline& operator=(VersionedObjectPipeline const&) = delete;
+
+    // runs all stages to completion; rethrows the first exception raised by any stage
+    void run(std::istream& input)
+    {
+      _resetMetrics();
+      _abort = false;
+      _firstError = nullptr;
+
+      SpscRingBuffer<std::unique_ptr<t_parsedRow>>   parsedQueue{_queueCapacity};
+      SpscRingBuffer<std::unique_ptr<t_rowGroup>>    groupQueue{_queueCapacity};
+      SpscRingBuffer<std::unique_ptr<t_objectUnit>>  insertedQueue{_queueCapacity};
+      SpscRingBuffer<std::unique_ptr<t_objectUnit>>  builtQueue{_queueCapacity};
+
+      const auto startTime = std::chrono::steady_clock::now();
+      std::vector<std::thread> stages;
+      stages.emplace_back([&]() { _guard(parsedQueue,   [&]() { _parseStage(input, parsedQueue); }); });
+      stages.emplace_back([&]() { _guard(groupQueue,    [&]() { _groupStage(parsedQueue, groupQueue); }); });
+      stages.emplace_back([&]() { _guard(insertedQueue, [&]() { _insertStage(groupQueue, insertedQueue); }); });
+      stages.emplace_back([&]() { _guard(builtQueue,    [&]() { _buildStage(insertedQueue, builtQueue); }); });
+      _exportStage(builtQueue);   // calling thread runs the last stage
+      for(std::thread& stage : stages)
+        stage.join();
+      _wallTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+
+      if(_firstError)
+        std::rethrow_exception(_firstError);
+    }
+
+    inline const std::array<PipelineStageMetrics, STAGE_COUNT>& getMetrics() const { return _metrics; }
+    inline std::chrono::nanoseconds getWallTime() const { return _wallTime; }
+
+    // exports each version as "objectKey<delimCSV>versionDate<delimCSV>dataset.toCSV()"
+    template<typename SH = StreamerHelper>
+    static t_export csvExporter(std::ostream& oss, const SH& streamerHelper = SH{})
+    {
+      return [&oss, streamerHelper](const std::string& objectKey, const t_versionedObject& vo)
+      {
+        std::string prefix{objectKey};
+        prefix += streamerHelper.getDelimiterCSV();
+        VersionedObjectStream<VDT, MT...>::createVOstreamer(vo).toCSV(prefix, oss, streamerHelper);
+      };
+    }
+
+  private:
+    struct t_rowGroup
+    {
+      std::string               objectKey;
+      std::vector<t_parsedRow>  rows;
+    };
+
+    struct t_objectUnit
+    {
+      std::string               objectKey;
+      t_versionedObjectBuilder  builder;
+      t_versionedObject         vo;
+
+      explicit t_objectUnit(const std::string& key) : objectKey(key), builder(), vo() {}
+    };
+
+    using t_clock = std::chrono::steady_clock;
+
+    const t_parser    _parser;
+    const t_build     _build;
+    const t_export    _exporter;
+    const size_t      _queueCapacity;
+    std::array<PipelineStageMetrics, STAGE_COUNT>  _metrics;
+    std::chrono::nanoseconds  _wallTime;
+    std::atomic<bool>         _abort;
+    std::exception_ptr        _firstError;
+    std::mutex                _errorMutex;
+
+    void _resetMetrics()
+    {
+      static const std::array<const char*, STAGE_COUNT> stageNames{"parse", "group", "insert", "build", "export"};
+      for(size_t iii = 0; iii < STAGE_COUNT; ++iii)
+        _metrics[iii] = PipelineStageMetrics{std::string{stageNames[iii]}};
+    }
+
+    // spins, then yields, then blocks on 'queue' until 'isReady()'
+    template<typename QUEUE, typename PRED>
+    static inline void _backoff(unsigned& spins, QUEUE& queue, PRED&& isReady)
+    {
+      if(++spins < 64)
+        return;
+      if(spins < 128)
+      {
+        std::this_thread::yield();
+        return;
+      }
+      queue.waitUntil(std::forward<PRED>(isReady), std::chrono::milliseconds(1));
+    }
+
+    static inline void _addElapsed(std::chrono::nanoseconds& accumulator, t_clock::time_point since)
+    {
+      accumulator += std::chrono::duration_cast<std::chrono::nanoseconds>(t_clock::now() - since);
+    }
+
+    // runs a stage; on error records it, aborts the other stages and always closes the stage's output
+    template<typename OUTQ, typename FN>
+    void _guard(OUTQ& outQueue, FN&& stageFn)
+    {
+      try {
+        stageFn();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(_errorMutex);
+        if(!_firstError)
+          _firstError = std::current_exception();
+        _abort = true;
+      }
+      outQueue.close();
+    }
+
+    // blocks until there is room downstream (backpressure)
+    template<typename T>
+    bool _push(SpscRingBuffer<T>& outQueue, T&& item, PipelineStageMetrics& metrics)
+    {
+      if(outQueue.tryPush(std::move(item)))
+      {
+        ++metrics.itemsOut;
+        return true;
+      }
+      const auto stallStart = t_clock::now();
+      unsigned spins = 0;
+      while(!outQueue.tryPush(std::move(item)))
+      {
+        if(_abort)
+        {
+          _addElapsed(metrics.stallTime, stallStart);
+          return false;
+        }
+        _backoff(spins, outQueue, [this, &outQueue]() { return !outQueue.isFull() || _abort; });
+      }
+      _addElapsed(metrics.stallTime, stallStart);
+      ++metrics.itemsOut;
+      return true;
+    }
+
+    // pops items until upstream is drained; fn(item) processes a single item
+    template<typename T, typename FN>
+    void _consume(SpscRingBuffer<T>& inQueue, PipelineStageMetrics& metrics, FN&& fn)
+    {
+      unsigned spins = 0;
+      std::optional<t_clock::time_point> starveStart;
+      while(!_abort)
+      {
+        std::optional<T> item = inQueue.tryPop();
+        if(!item)
+        {
+          if(inQueue.isDrained())
+            break;
+          if(!starveStart)
+            starveStart = t_clock::now();
+          _backoff(spins, inQueue, [this, &inQueue]() { return !inQueue.isEmpty() || inQueue.isClosed() || _abort; });
+          continue;
+        }
+        if(starveStart)
+        {
+          _addElapsed(metrics.starveTime, *starveStart);
+          starveStart.reset();
+        }
+        spins = 0;
+        ++metrics.itemsIn;
+        // fn() may _push() downstream; that wait is already in stallTime and is not busy work
+        const std::chrono::nanoseconds stallBefore = metrics.stallTime;
+        const auto busyStart = t_clock::now();
+        fn(std::move(*item));
+        _addElapsed(metrics.busyTime, busyStart);
+        metrics.busyTime -= metrics.stallTime - stallBefore;
+      }
+    }
+
+    void _parseStage(std::istream& input, SpscRingBuffer<std::unique_ptr<t_parsedRow>>& outQueue)
+    {
+      PipelineStageMetrics& metrics = _metrics[PARSE];
+      std::string line;
+      while(!_abort)
+      {
+        const auto busyStart = t_clock::now();
+        if(!std::getline(input, line))
+          break;
+        ++metrics.itemsIn;
+        std::optional<t_parsedRow> row = _parser(line);
+        _addElapsed(metrics.busyTime, busyStart);
+        if(row)
+        {
+          std::unique_ptr<t_parsedRow> item = std::make_unique<t_parsedRow>(std::move(*row));
+          if(!_push(outQueue, std::move(item), metrics))
+            return;
+        }
+      }
+    }
+
+    void _groupStage(SpscRingBuffer<std::unique_ptr<t_parsedRow>>& inQueue,
+                     SpscRingBuffer<std::unique_ptr<t_rowGroup>>& outQueue)
+    {
+      PipelineStageMetrics& metrics = _metrics[GROUP];
+      std::set<std::string> closedKeys;
+      std::unique_ptr<t_rowGroup> group;
+      _consume(inQueue, metrics, [&](std::unique_ptr<t_parsedRow>&& row)
+      {
+        if(group && group->objectKey != row->objectKey)
+        {
+          closedKeys.insert(group->objectKey);
+          if(!_push(outQueue, std::move(group), metrics))
+            return;
+        }
+        if(!group)
+        {
+          if(closedKeys.find(row->objectKey) != closedKeys.end())
+          {
+            throw VO_Pipeline_exception("ERROR : VersionedObjectPipeline : input is not clustered by objectKey, '"
+                                        + row->objectKey + "' re-appears after its group was closed");
+          }
+          group = std::make_unique<t_rowGroup>(t_rowGroup{row->objectKey, {}});
+        }
+        group->rows.push_back(std::move(*row));
+      });
+      if(group && !_abort)
+        _push(outQueue, std::move(group), metrics);
+    }
+
+    void _insertStage(SpscRingBuffer<std::unique_ptr<t_rowGroup>>& inQueue,
+                      SpscRingBuffer<std::unique_ptr<t_objectUnit>>& outQueue)
+    {
+      PipelineStageMetrics& metrics = _metrics[INSERT];
+      _consume(inQueue, metrics, [&](std::unique_ptr<t_rowGroup>&& group)
+      {
+        std::unique_ptr<t_objectUnit> unit = std::make_unique<t_objectUnit>(group->objectKey);
+        for(const t_parsedRow& row : group->rows)
+        {
+          if(const t_changesInDataSet* delta = std::get_if<t_changesInDataSet>(&row.entry))
+            unit->builder.insertDeltaVersion(row.versionDate, *delta);
+          else if(const t_snapshotDataSet* snapshot = std::get_if<t_snapshotDataSet>(&row.entry))
+            unit->builder.insertSnapshotVersion(row.versionDate, *snapshot);
+          else
+            unit->vo.insertVersion(row.versionDate, std::get<t_dataset>(row.entry));
+        }
+        _push(outQueue, std::move(unit), metrics);
+      });
+    }
+
+    void _buildStage(SpscRingBuffer<std::unique_ptr<t_objectUnit>>& inQueue,
+                     SpscRingBuffer<std::unique_ptr<t_objectUnit>>& outQueue)
+    {
+      PipelineStageMetrics& metrics = _metrics[BUILD];
+      _consume(inQueue, metrics, [&](std::unique_ptr<t_objectUnit>&& unit)
+      {
+        _build(unit->objectKey, unit->builder, unit->vo);
+        unit->builder.clear();
+        _push(outQueue, std::move(unit), metrics);
+      });
+    }
+
+    void _exportStage(SpscRingBuffer<std::unique_ptr<t_objectUnit>>& inQueue)
+    {
+      PipelineStageMetrics& metrics = _metrics[EXPORT];
+      try {
+        _consume(inQueue, metrics, [&](std::unique_ptr<t_objectUnit>&& unit)
+        {
+          _exporter(unit->objectKey, unit->vo);
+          ++metrics.itemsOut;
+        });
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(_errorMutex);
+        if(!_firstError)
+          _firstError = std::current_exception();
+        _abort = true;
+      }
+    }
+  };
+
+} }   //  namespace datastructure::versionedObject
@@ -14,7 +14,13 @@
 #pragma once
 
 #include <array>
+#include <tuple>
 #include <chrono>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
 
 #include <versionedObject/VersionedObject.h>
 
@@ -25,6 +31,18 @@ namespace datastructure { namespace versionedObject
 
   using VOPM_Record_Mismatch_exception = VO_exception<2>;
 
+  // a field on which the records of the 2 merge-candidates differ at 'versionDate'
+  template <typename VDT>
+  struct PriorityMergeConflict
+  {
+    VDT          versionDate;
+    size_t       fieldIndex;          // index of the field in the record tuple
+    std::string  highPriorityValue;   // value kept in the merge result
+    std::string  lowrPriorityValue;
+
+    inline bool operator==(const PriorityMergeConflict& other) const = default;
+  };
+
   template <typename VDT, typename ... MT>
   class VersionedObjectPriorityMerge
   {
@@ -36,6 +54,8 @@ namespace datastructure { namespace versionedObject
     using t_StreamerHelper   = typename t_dataset::t_StreamerHelper;
     using t_datasetLedger    = typename t_versionedObject::t_datasetLedger;
 
+    using t_mergeConflict    = PriorityMergeConflict<VDT>;
+
     VersionedObjectPriorityMerge(
       const t_versionedObject& highPriorityVersionedObject,
       const t_versionedObject& lowrPriorityVersionedObject
@@ -45,10 +65,126 @@ namespace datastructure { namespace versionedObject
 
     virtual ~VersionedObjectPriorityMerge() {}
 
+    // throws VOPM_Record_Mismatch_exception at the first date where the records differ
     void getMergeResult(t_versionedObject& mergeVersionedObject) const
+    {
+      _getMergeResult(mergeVersionedObject, nullptr);
+    }
+
+    /*
+     * conflict-report mode : where the records at a date differ, the high-priority record is kept
+     * ( with the metaData of both merged, as for equal records ) and the merge carries on.
+     * Every differing field is appended to 'conflicts', in date order then field order.
+     */
+    void getMergeResult(t_versionedObject& mergeVersionedObject, std::vector<t_mergeConflict>& conflicts) const
+    {
+      _getMergeResult(mergeVersionedObject, &conflicts);
+    }
+
+    /*
+     * same merge for inputs that are not needed afterwards : the versions are spliced, as ledger
+     * nodes, from the inputs into 'mergeVersionedObject' instead of being copied. Only a date held
+     * by both sources builds a new dataset, when there is metaData to merge.
+     * The dates held by both are checked, and their metaData merged, before anything is spliced :
+     * on a VOPM_Record_Mismatch_exception or a MergeError_MetaDataSource_exception both inputs and
+     * 'mergeVersionedObject' are left as they were. Otherwise both inputs are left empty.
+     */
+    static void getMergeResult(t_versionedObject&& highPriorityVersionedObject,
+                               t_versionedObject&& lowrPriorityVersionedObject,
+                               t_versionedObject& mergeVersionedObject)
+    {
+      [[maybe_unused]] auto mergedMetaData = _checkSameDates(highPriorityVersionedObject.getDatasetLedger(),
+                                                             lowrPriorityVersionedObject.getDatasetLedger());
+      [[maybe_unused]] size_t mergedMetaDataIdx = 0;
+
+      t_datasetLedger highPriorityLedger = highPriorityVersionedObject.releaseLedger();
+      t_datasetLedger lowrPriorityLedger = lowrPriorityVersionedObject.releaseLedger();
+      mergeVersionedObject.reserveVersions(highPriorityLedger.size() + lowrPriorityLedger.size());
+
+      while(!highPriorityLedger.empty() && !lowrPriorityLedger.empty())
+      {
+        const typename t_datasetLedger::iterator iterHighPriorityVO = highPriorityLedger.begin();
+        const typename t_datasetLedger::iterator iterLowrPriorityVO = lowrPriorityLedger.begin();
+        if(iterHighPriorityVO->first < iterLowrPriorityVO->first) {
+          mergeVersionedObject.appendVersion(highPriorityLedger.extract(iterHighPriorityVO));
+        } else if(iterLowrPriorityVO->first < iterHighPriorityVO->first) {
+          mergeVersionedObject.appendVersion(lowrPriorityLedger.extract(iterLowrPriorityVO));
+        } else {
+          if constexpr(t_dataset::hasMetaData()) {
+            mergeVersionedObject.appendVersion(iterHighPriorityVO->first, std::move(mergedMetaData[mergedMetaDataIdx++]),
+                                               iterHighPriorityVO->second.getRecord());
+            highPriorityLedger.erase(iterHighPriorityVO);
+          } else {
+            mergeVersionedObject.appendVersion(highPriorityLedger.extract(iterHighPriorityVO));
+          }
+          lowrPriorityLedger.erase(iterLowrPriorityVO);
+        }
+      }
+
+      while(!highPriorityLedger.empty())
+      {
+        mergeVersionedObject.appendVersion(highPriorityLedger.extract(highPriorityLedger.begin()));
+      }
+      while(!lowrPriorityLedger.empty())
+      {
+        mergeVersionedObject.appendVersion(lowrPriorityLedger.extract(lowrPriorityLedger.begin()));
+      }
+    }
+
+  private:
+    const t_versionedObject& _highPriorityVersionedObject;
+    const t_versionedObject& _lowrPriorityVersionedObject;
+
+    /*
+     * first pass of the splicing merge, on the inputs as they are : throws at the first date held by
+     * both whose records differ. With metaData, returns the merged metaData of those dates in date order.
+     */
+    static auto _checkSameDates(const t_datasetLedger& highPriorityLedger, const t_datasetLedger& lowrPriorityLedger)
+    {
+      if constexpr(t_dataset::hasMetaData()) {
+        std::vector<typename t_dataset::t_metaData> mergedMetaData;
+        _forSameDates(highPriorityLedger, lowrPriorityLedger,
+          [&mergedMetaData](const t_dataset& highPriorityDataset, const t_dataset& lowrPriorityDataset)
+          {
+            mergedMetaData.push_back(highPriorityDataset.getMetaData());
+            mergedMetaData.back().mergeVersion(lowrPriorityDataset.getMetaData());
+          });
+        return mergedMetaData;
+      } else {
+        _forSameDates(highPriorityLedger, lowrPriorityLedger, [](const t_dataset&, const t_dataset&) {});
+        return 0;
+      }
+    }
+
+    template<typename FN>
+    static void _forSameDates(const t_datasetLedger& highPriorityLedger, const t_datasetLedger& lowrPriorityLedger, FN&& fn)
+    {
+      typename t_datasetLedger::const_iterator iterHighPriorityVO = highPriorityLedger.cbegin();
+      typename t_datasetLedger::const_iterator iterLowrPriorityVO = lowrPriorityLedger.cbegin();
+      while(iterHighPriorityVO != highPriorityLedger.cend() && iterLowrPriorityVO != lowrPriorityLedger.cend())
+      {
+        if(iterHighPriorityVO->first < iterLowrPriorityVO->first) {
+          ++iterHighPriorityVO;
+        } else if(iterLowrPriorityVO->first < iterHighPriorityVO->first) {
+          ++iterLowrPriorityVO;
+        } else {
+          if(iterHighPriorityVO->second.getRecord() != iterLowrPriorityVO->second.getRecord())
+          {
+            _throwRecordMismatch(iterHighPriorityVO->first, iterHighPriorityVO->second, iterLowrPriorityVO->second);
+          }
+          fn(iterHighPriorityVO->second, iterLowrPriorityVO->second);
+          ++iterHighPriorityVO;
+          ++iterLowrPriorityVO;
+        }
+      }
+    }
+
+    void _getMergeResult(t_versionedObject& mergeVersionedObject, std::vector<t_mergeConflict>* conflicts) const
     {
       typename t_datasetLedger::const_iterator iterHighPriorityVO = _highPriorityVersionedObject.getDatasetLedger().cbegin();
       typename t_datasetLedger::const_iterator iterLowrPriorityVO = _lowrPriorityVersionedObject.getDatasetLedger().cbegin();
+      mergeVersionedObject.reserveVersions(_highPriorityVersionedObject.getDatasetLedger().size() +
+                                           _lowrPriorityVersionedObject.getDatasetLedger().size());
 
       while(iterHighPriorityVO != _highPriorityVersionedObject.getDatasetLedger().cend() &&
             iterLowrPriorityVO != _lowrPriorityVersionedObject.getDatasetLedger().cend())
@@ -58,17 +194,21 @@ namespace datastructure { namespace versionedObject
         const t_dataset& highPriorityDataset = iterHighPriorityVO->second;
         const t_dataset& lowrPriorityDataset = iterLowrPriorityVO->second;
         if(highPriorityDate == lowrPriorityDate) {
-          if(highPriorityDataset.getRecord() == lowrPriorityDataset.getRecord()) {
+          const bool sameRecord = highPriorityDataset.getRecord() == lowrPriorityDataset.getRecord();
+          if(sameRecord || conflicts != nullptr) {
+            if(!sameRecord) {
+              _appendConflicts(highPriorityDate, highPriorityDataset.getRecord(), lowrPriorityDataset.getRecord(),
+                               *conflicts, std::make_index_sequence<std::tuple_size_v<t_record>>{});
+            }
             try {
               if constexpr(t_dataset::hasMetaData()) {
                 // metaData need NOT be equal (when data from different sources)
                 using t_metaData         = typename t_dataset::t_metaData;
                 t_metaData hpMetaData {highPriorityDataset.getMetaData()};
                 hpMetaData.mergeVersion(lowrPriorityDataset.getMetaData());
-                t_dataset highPriorityDataset_metaMerge{hpMetaData, highPriorityDataset.getRecord()};
-                mergeVersionedObject.insertVersion(highPriorityDate, highPriorityDataset_metaMerge);
+                mergeVersionedObject.appendVersion(highPriorityDate, std::move(hpMetaData), highPriorityDataset.getRecord());
               } else {
-                mergeVersionedObject.insertVersion(highPriorityDate, highPriorityDataset);
+                mergeVersionedObject.appendVersion(highPriorityDate, highPriorityDataset);
               }
             } catch(...) {
               std::cout << "ERROR : VersionedObjectPriorityMerge::getMergeResult()-> versionDate[" << highPriorityDate << "]" << std::endl;
@@ -77,21 +217,13 @@ namespace datastructure { namespace versionedObject
             ++iterHighPriorityVO;
             ++iterLowrPriorityVO;
           } else {
-            static std::string errMsg("ERROR : failure in VersionedObjectPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits between 2 merge-candidates of VersionedObject");
-#if FLAG_VERSIONEDOBJECT_debug_log == 1
-            std::ostringstream eoss;
-            eoss << errMsg << " : forDate=" << highPriorityDate;
-            eoss <<   " : highPriorityDataset={ " << highPriorityDataset.toCSV(t_StreamerHelper{});
-            eoss << " } : lowrPriorityDataset={ " << lowrPriorityDataset.toCSV(t_StreamerHelper{}) << " }";
-            VERSIONEDOBJECT_DEBUG_LOG(eoss.str());
-#endif
-            throw VOPM_Record_Mismatch_exception(errMsg);
+            _throwRecordMismatch(highPriorityDate, highPriorityDataset, lowrPriorityDataset);
           }
         } else if(highPriorityDate < lowrPriorityDate) {
-          mergeVersionedObject.insertVersion(highPriorityDate, highPriorityDataset);
+          mergeVersionedObject.appendVersion(highPriorityDate, highPriorityDataset);
           ++iterHighPriorityVO;
         } else { // (highPriorityDate > lowrPriorityDate)
-          mergeVersionedObject.insertVersion(lowrPriorityDate, lowrPriorityDataset);
+          mergeVersionedObject.appendVersion(lowrPriorityDate, lowrPriorityDataset);
           ++iterLowrPriorityVO;
         }
       }
@@ -100,7 +232,7 @@ namespace datastructure { namespace versionedObject
       {
         const t_versionDate& highPriorityDate = iterHighPriorityVO->first;
         const t_dataset& highPriorityDataset = iterHighPriorityVO->second;
-        mergeVersionedObject.insertVersion(highPriorityDate, highPriorityDataset);
+        mergeVersionedObject.appendVersion(highPriorityDate, highPriorityDataset);
         ++iterHighPriorityVO;
       }
 
@@ -108,13 +240,285 @@ namespace datastructure { namespace versionedObject
       {
         const t_versionDate& lowrPriorityDate = iterLowrPriorityVO->first;
         const t_dataset& lowrPriorityDataset = iterLowrPriorityVO->second;
-        mergeVersionedObject.insertVersion(lowrPriorityDate, lowrPriorityDataset);
+        mergeVersionedObject.appendVersion(lowrPriorityDate, lowrPriorityDataset);
         ++iterLowrPriorityVO;
       }
     }
 
+    [[noreturn]] static void _throwRecordMismatch([[maybe_unused]] const t_versionDate& forDate,
+                                                  [[maybe_unused]] const t_dataset& highPriorityDataset,
+                                                  [[maybe_unused]] const t_dataset& lowrPriorityDataset)
+    {
+      static std::string errMsg("ERROR : failure in VersionedObjectPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits between 2 merge-candidates of VersionedObject");
+#if FLAG_VERSIONEDOBJECT_debug_log == 1
+      std::ostringstream eoss;
+      eoss << errMsg << " : forDate=" << forDate;
+      eoss <<   " : highPriorityDataset={ " << highPriorityDataset.toCSV(t_StreamerHelper{});
+      eoss << " } : lowrPriorityDataset={ " << lowrPriorityDataset.toCSV(t_StreamerHelper{}) << " }";
+      VERSIONEDOBJECT_DEBUG_LOG(eoss.str());
+#endif
+      throw VOPM_Record_Mismatch_exception(errMsg);
+    }
+
+    template<size_t ... IDX>
+    static void _appendConflicts(const t_versionDate& forDate,
+                                 const t_record& highPriorityRecord, const t_record& lowrPriorityRecord,
+                                 std::vector<t_mergeConflict>& conflicts, std::index_sequence<IDX...>)
+    {
+      ( _appendFieldConflict<IDX>(forDate, highPriorityRecord, lowrPriorityRecord, conflicts), ... );
+    }
+
+    template<size_t IDX>
+    static inline void _appendFieldConflict(const t_versionDate& forDate,
+                                            const t_record& highPriorityRecord, const t_record& lowrPriorityRecord,
+                                            std::vector<t_mergeConflict>& conflicts)
+    {
+      const auto& highPriorityField = std::get<IDX>(highPriorityRecord);
+      const auto& lowrPriorityField = std::get<IDX>(lowrPriorityRecord);
+      if(highPriorityField != lowrPriorityField)
+      {
+        using t_field = std::tuple_element_t<IDX, t_record>;
+        conflicts.push_back({ forDate, IDX,
+                              converter::ConvertFromTuple<t_field>::ToStr(std::tuple<t_field>{highPriorityField}, ','),
+                              converter::ConvertFromTuple<t_field>::ToStr(std::tuple<t_field>{lowrPriorityField}, ',') });
+      }
+    }
+  };
+
+  /*
+   * N-way counterpart of VersionedObjectPriorityMerge, 'versionedObjects' given in priority order
+   * ( first is the highest ). A min-heap over the N ledger iterators yields the versions in date
+   * order, so the merged ledger is built in a single pass; chaining pairwise merges would
+   * materialize an intermediate VersionedObject per step.
+   * Same semantics as the pairwise merge : the records at a date held by several sources must be
+   * equal, and the highest priority dataset is kept with the others' metaData merged into it
+   * ( mergeVersion() in priority order ).
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectKWayPriorityMerge
+  {
+  public:
+    using t_versionDate      = VDT;
+    using t_versionedObject  = VersionedObject<VDT, MT...>;
+    using t_dataset          = DataSet<MT...>;
+    using t_record           = typename t_dataset::t_record;
+    using t_StreamerHelper   = typename t_dataset::t_StreamerHelper;
+    using t_datasetLedger    = typename t_versionedObject::t_datasetLedger;
+
+    explicit VersionedObjectKWayPriorityMerge(
+      std::vector<std::reference_wrapper<const t_versionedObject>> versionedObjects
+    ) : _versionedObjects(std::move(versionedObjects))
+    {}
+
+    virtual ~VersionedObjectKWayPriorityMerge() {}
+
+    void getMergeResult(t_versionedObject& mergeVersionedObject) const
+    {
+      std::vector<t_cursor> cursorHeap;
+      cursorHeap.reserve(_versionedObjects.size());
+      for(size_t priority = 0; priority < _versionedObjects.size(); ++priority)
+      {
+        const t_datasetLedger& datasetLedger = _versionedObjects[priority].get().getDatasetLedger();
+        if(!datasetLedger.empty())
+        {
+          cursorHeap.emplace_back(datasetLedger.cbegin(), priority);
+        }
+      }
+      std::make_heap(cursorHeap.begin(), cursorHeap.end(), _laterCursor);
+
+      // cursors at the earliest date, popped in priority order
+      std::vector<t_cursor> sameDateCursors;
+      sameDateCursors.reserve(_versionedObjects.size());
+      while(!cursorHeap.empty())
+      {
+        sameDateCursors.clear();
+        do {
+          std::pop_heap(cursorHeap.begin(), cursorHeap.end(), _laterCursor);
+          sameDateCursors.push_back(cursorHeap.back());
+          cursorHeap.pop_back();
+        } while( !cursorHeap.empty() &&
+                 !(sameDateCursors.front().first->first < cursorHeap.front().first->first) );
+
+        _mergeSameDate(sameDateCursors, mergeVersionedObject);
+
+        for(auto& [ledgerIter, priority] : sameDateCursors)
+        {
+          if(++ledgerIter != _versionedObjects[priority].get().getDatasetLedger().cend())
+          {
+            cursorHeap.emplace_back(ledgerIter, priority);
+            std::push_heap(cursorHeap.begin(), cursorHeap.end(), _laterCursor);
+          }
+        }
+      }
+    }
+
   private:
-    const t_versionedObject& _highPriorityVersionedObject;
-    const t_versionedObject& _lowrPriorityVersionedObject;
+    // ( position in a source's ledger, priority of the source )
+    using t_cursor = std::pair<typename t_datasetLedger::const_iterator, size_t>;
+
+    const std::vector<std::reference_wrapper<const t_versionedObject>> _versionedObjects;
+
+    // heap order : earliest date on top, and the higher priority among equal dates
+    static inline bool _laterCursor(const t_cursor& lhs, const t_cursor& rhs)
+    {
+      if(rhs.first->first < lhs.first->first) return true;
+      if(lhs.first->first < rhs.first->first) return false;
+      return rhs.second < lhs.second;
+    }
+
+    void _mergeSameDate(const std::vector<t_cursor>& sameDateCursors, t_versionedObject& mergeVersionedObject) const
+    {
+      const t_versionDate& forDate = sameDateCursors.front().first->first;
+      const t_dataset& highPriorityDataset = sameDateCursors.front().first->second;
+      for(size_t idx = 1; idx < sameDateCursors.size(); ++idx)
+      {
+        const t_dataset& lowrPriorityDataset = sameDateCursors[idx].first->second;
+        if(highPriorityDataset.getRecord() != lowrPriorityDataset.getRecord())
+        {
+          static std::string errMsg("ERROR : failure in VersionedObjectKWayPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits between merge-candidates of VersionedObject");
+#if FLAG_VERSIONEDOBJECT_debug_log == 1
+          std::ostringstream eoss;
+          eoss << errMsg << " : forDate=" << forDate;
+          eoss << " : priority[" << sameDateCursors.front().second << "]Dataset={ " << highPriorityDataset.toCSV(t_StreamerHelper{});
+          eoss << " } : priority[" << sameDateCursors[idx].second << "]Dataset={ " << lowrPriorityDataset.toCSV(t_StreamerHelper{}) << " }";
+          VERSIONEDOBJECT_DEBUG_LOG(eoss.str());
+#endif
+          throw VOPM_Record_Mismatch_exception(errMsg);
+        }
+      }
+
+      try {
+        if constexpr(t_dataset::hasMetaData()) {
+          if(sameDateCursors.size() > 1)
+          {
+            // metaData need NOT be equal (when data from different sources)
+            using t_metaData         = typename t_dataset::t_metaData;
+            t_metaData hpMetaData {highPriorityDataset.getMetaData()};
+            for(size_t idx = 1; idx < sameDateCursors.size(); ++idx)
+            {
+              hpMetaData.mergeVersion(sameDateCursors[idx].first->second.getMetaData());
+            }
+            mergeVersionedObject.appendVersion(forDate, std::move(hpMetaData), highPriorityDataset.getRecord());
+            return;
+          }
+        }
+        mergeVersionedObject.appendVersion(forDate, highPriorityDataset);
+      } catch(...) {
+        std::cout << "ERROR : VersionedObjectKWayPriorityMerge::getMergeResult()-> versionDate[" << forDate << "]" << std::endl;
+        throw;
+      }
+    }
+  };
+
+  enum class eFieldSource { PRIMARY, SECONDARY };
+
+  /*
+   * per-field source ranking of VersionedObjectFieldPriorityMerge, one entry per field of the record.
+   * e.g. symbol and name from the exchange, market-lot from the depository :
+   *   FieldPriorityPolicy< eFieldSource::PRIMARY, eFieldSource::PRIMARY, ..., eFieldSource::SECONDARY, ... >
+   */
+  template <eFieldSource ... FS>
+  struct FieldPriorityPolicy
+  {
+    static constexpr std::array<eFieldSource, sizeof...(FS)> preferredSource{FS...};
+  };
+
+  /*
+   * field-level counterpart of VersionedObjectPriorityMerge : records are not compared as a whole,
+   * each field is resolved on its own and never fails.
+   * At every versionDate of either source, a field is taken from the version in effect ( see
+   * getVersionAt() ) of the source POLICY prefers for it, or of the other source while the preferred
+   * one has no version yet. Both ledgers are walked once.
+   * metaData is that of the source(s) with a version at the date, mergeVersion()'d when both have.
+   */
+  template <typename POLICY, typename VDT, typename ... MT>
+  class VersionedObjectFieldPriorityMerge
+  {
+  public:
+    using t_versionDate      = VDT;
+    using t_versionedObject  = VersionedObject<VDT, MT...>;
+    using t_dataset          = DataSet<MT...>;
+    using t_record           = typename t_dataset::t_record;
+    using t_datasetLedger    = typename t_versionedObject::t_datasetLedger;
+
+    static_assert(POLICY::preferredSource.size() == std::tuple_size_v<t_record>,
+                  "FieldPriorityPolicy needs one eFieldSource per field of the record");
+
+    VersionedObjectFieldPriorityMerge(
+      const t_versionedObject& primaryVersionedObject,
+      const t_versionedObject& secondaryVersionedObject
+    ) : _primaryVersionedObject(primaryVersionedObject),
+        _secondaryVersionedObject(secondaryVersionedObject)
+    {}
+
+    virtual ~VersionedObjectFieldPriorityMerge() {}
+
+    void getMergeResult(t_versionedObject& mergeVersionedObject) const
+    {
+      const t_datasetLedger& primaryLedger   = _primaryVersionedObject.getDatasetLedger();
+      const t_datasetLedger& secondaryLedger = _secondaryVersionedObject.getDatasetLedger();
+      typename t_datasetLedger::const_iterator iterPrimaryVO   = primaryLedger.cbegin();
+      typename t_datasetLedger::const_iterator iterSecondaryVO = secondaryLedger.cbegin();
+      const t_dataset* primaryInEffect   = nullptr;
+      const t_dataset* secondaryInEffect = nullptr;
+      mergeVersionedObject.reserveVersions(primaryLedger.size() + secondaryLedger.size());
+
+      while(iterPrimaryVO != primaryLedger.cend() || iterSecondaryVO != secondaryLedger.cend())
+      {
+        const bool atPrimary   = iterSecondaryVO == secondaryLedger.cend() ||
+                                 ( iterPrimaryVO != primaryLedger.cend() && !(iterSecondaryVO->first < iterPrimaryVO->first) );
+        const bool atSecondary = iterPrimaryVO == primaryLedger.cend() ||
+                                 ( iterSecondaryVO != secondaryLedger.cend() && !(iterPrimaryVO->first < iterSecondaryVO->first) );
+        const t_versionDate& forDate = atPrimary ? iterPrimaryVO->first : iterSecondaryVO->first;
+        if(atPrimary)   primaryInEffect   = &(iterPrimaryVO->second);
+        if(atSecondary) secondaryInEffect = &(iterSecondaryVO->second);
+
+        t_record mergeRecord{ (primaryInEffect != nullptr ? primaryInEffect : secondaryInEffect)->getRecord() };
+        if(primaryInEffect != nullptr && secondaryInEffect != nullptr)
+        {
+          _takeSecondaryFields<std::tuple_size_v<t_record> - 1>(mergeRecord, secondaryInEffect->getRecord());
+        }
+
+        try {
+          if constexpr(t_dataset::hasMetaData()) {
+            using t_metaData         = typename t_dataset::t_metaData;
+            t_metaData mergeMetaData {(atPrimary ? iterPrimaryVO : iterSecondaryVO)->second.getMetaData()};
+            if(atPrimary && atSecondary)
+            {
+              mergeMetaData.mergeVersion(iterSecondaryVO->second.getMetaData());
+            }
+            mergeVersionedObject.appendVersion(forDate, std::move(mergeMetaData), mergeRecord);
+          } else {
+            mergeVersionedObject.appendVersion(forDate, mergeRecord);
+          }
+        } catch(...) {
+          std::cout << "ERROR : VersionedObjectFieldPriorityMerge::getMergeResult()-> versionDate[" << forDate << "]" << std::endl;
+          throw;
+        }
+
+        if(atPrimary)   ++iterPrimaryVO;
+        if(atSecondary) ++iterSecondaryVO;
+      }
+    }
+
+  private:
+    const t_versionedObject& _primaryVersionedObject;
+    const t_versionedObject& _secondaryVersionedObject;
+
+    // 'mergeRecord' starts as the primary record, only the fields ranked SECONDARY are overwritten
+    template<size_t IDX>
+    static inline void _takeSecondaryFields(t_record& mergeRecord, const t_record& secondaryRecord)
+    {
+      if constexpr( POLICY::preferredSource[IDX] == eFieldSource::SECONDARY )
+      {
+        std::get<IDX>(mergeRecord) = std::get<IDX>(secondaryRecord);
+      }
+
+      if constexpr( IDX > 0 )
+      {
+        // "((IDX>0)?(IDX-1):0)" eliminates infinite compile time looping
+        _takeSecondaryFields< ((IDX>0)?(IDX-1):0) >(mergeRecord, secondaryRecord);
+      }
+    }
   };
 } }  //  datastructure::versionedObject
@@ -0,0 +1,238 @@
+/*
+ * VersionedObjectPriorityMergeView.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  /*
+   * read-only view of what VersionedObjectPriorityMerge::getMergeResult() would produce, without
+   * materializing it. getVersionAt(), getVersionBefore() and iteration position themselves on the
+   * ledgers of both sources, priority is resolved only for the version dereferenced.
+   * As in the merge, the records of a date held by both sources must be equal : dereferencing such
+   * a date throws VOPM_Record_Mismatch_exception when they are not.
+   * The view refers to the sources, they must outlive it and not be modified while it is in use.
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectPriorityMergeView
+  {
+  public:
+    using t_versionDate      = VDT;
+    using t_versionedObject  = VersionedObject<VDT, MT...>;
+    using t_dataset          = DataSet<MT...>;
+    using t_record           = typename t_dataset::t_record;
+    using t_StreamerHelper   = typename t_dataset::t_StreamerHelper;
+    using t_datasetLedger    = typename t_versionedObject::t_datasetLedger;
+
+    // a version of the merged timeline, refers to the datasets of the sources
+    class MergedVersion
+    {
+    public:
+      inline const t_versionDate& getVersionDate() const { return *_versionDate; }
+      inline const t_record&      getRecord()      const { return _dataset->getRecord(); }
+      inline bool                 isFromBothSources() const { return _lowrPriorityDataset != nullptr; }
+
+      // the dataset the merge would hold : of the higher priority source, with the metaData of both merged
+      t_dataset getDataset() const
+      {
+        if constexpr(t_dataset::hasMetaData()) {
+          if(_lowrPriorityDataset != nullptr)
+          {
+            using t_metaData         = typename t_dataset::t_metaData;
+            t_metaData hpMetaData {_dataset->getMetaData()};
+            hpMetaData.mergeVersion(_lowrPriorityDataset->getMetaData());
+            return t_dataset{std::move(hpMetaData), _dataset->getRecord()};
+          }
+        }
+        return *_dataset;
+      }
+
+    private:
+      friend class VersionedObjectPriorityMergeView;
+
+      MergedVersion(const t_versionDate* versionDate, const t_dataset* dataset, const t_dataset* lowrPriorityDataset)
+        : _versionDate(versionDate), _dataset(dataset), _lowrPriorityDataset(lowrPriorityDataset)
+      {}
+
+      const t_versionDate*  _versionDate;
+      const t_dataset*      _dataset;               // higher priority one, when the date is in both sources
+      const t_dataset*      _lowrPriorityDataset;   // nullptr, unless the date is in both sources
+    };
+
+    // forward iteration over the merged timeline, in versionDate order
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type        = MergedVersion;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = void;
+      using reference         = MergedVersion;
+
+      const_iterator() = default;
+
+      MergedVersion operator*() const
+      {
+        const bool atHigh = _atHighPriority();
+        const bool atLowr = _atLowrPriority();
+        if(atHigh && atLowr)
+        {
+          if(_highIter->second.getRecord() != _lowrIter->second.getRecord())
+          {
+            static std::string errMsg("ERROR : failure in VersionedObjectPriorityMergeView<VDT, MT...>::const_iterator::operator*() : different 'record' exits between 2 merge-candidates of VersionedObject");
+#if FLAG_VERSIONEDOBJECT_debug_log == 1
+            std::ostringstream eoss;
+            eoss << errMsg << " : forDate=" << _highIter->first;
+            eoss <<   " : highPriorityDataset={ " << _highIter->second.toCSV(t_StreamerHelper{});
+            eoss << " } : lowrPriorityDataset={ " << _lowrIter->second.toCSV(t_StreamerHelper{}) << " }";
+            VERSIONEDOBJECT_DEBUG_LOG(eoss.str());
+#endif
+            throw VOPM_Record_Mismatch_exception(errMsg);
+          }
+          return MergedVersion{&(_highIter->first), &(_highIter->second), &(_lowrIter->second)};
+        }
+        const typename t_datasetLedger::const_iterator& versionIter = atHigh ? _highIter : _lowrIter;
+        return MergedVersion{&(versionIter->first), &(versionIter->second), nullptr};
+      }
+
+      const_iterator& operator++()
+      {
+        const bool atHigh = _atHighPriority();
+        const bool atLowr = _atLowrPriority();
+        if(atHigh) ++_highIter;
+        if(atLowr) ++_lowrIter;
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator prevIter{*this};
+        ++(*this);
+        return prevIter;
+      }
+
+      bool operator==(const const_iterator& other) const
+      {
+        return _highIter == other._highIter && _lowrIter == other._lowrIter;
+      }
+
+    private:
+      friend class VersionedObjectPriorityMergeView;
+
+      const_iterator(typename t_datasetLedger::const_iterator highIter, typename t_datasetLedger::const_iterator highEnd,
+                     typename t_datasetLedger::const_iterator lowrIter, typename t_datasetLedger::const_iterator lowrEnd)
+        : _highIter(highIter), _highEnd(highEnd), _lowrIter(lowrIter), _lowrEnd(lowrEnd)
+      {}
+
+      // the current version is the earlier of the 2 positions
+      inline bool _atHighPriority() const
+      {
+        return _highIter != _highEnd && ( _lowrIter == _lowrEnd || !(_lowrIter->first < _highIter->first) );
+      }
+      inline bool _atLowrPriority() const
+      {
+        return _lowrIter != _lowrEnd && ( _highIter == _highEnd || !(_highIter->first < _lowrIter->first) );
+      }
+
+      typename t_datasetLedger::const_iterator  _highIter{};
+      typename t_datasetLedger::const_iterator  _highEnd{};
+      typename t_datasetLedger::const_iterator  _lowrIter{};
+      typename t_datasetLedger::const_iterator  _lowrEnd{};
+    };
+
+    VersionedObjectPriorityMergeView(
+      const t_versionedObject& highPriorityVersionedObject,
+      const t_versionedObject& lowrPriorityVersionedObject
+    ) : _highPriorityVersionedObject(highPriorityVersionedObject),
+        _lowrPriorityVersionedObject(lowrPriorityVersionedObject)
+    {}
+
+    virtual ~VersionedObjectPriorityMergeView() {}
+
+    inline const_iterator begin() const
+    {
+      return _makeIterator(_highLedger().cbegin(), _lowrLedger().cbegin());
+    }
+
+    inline const_iterator end() const
+    {
+      return _makeIterator(_highLedger().cend(), _lowrLedger().cend());
+    }
+
+    inline bool empty() const
+    {
+      return _highLedger().empty() && _lowrLedger().empty();
+    }
+
+    // same as VersionedObject::getVersionAt() on the merge result : version in effect at 'forDate', or end()
+    inline const_iterator getVersionAt(const t_versionDate& forDate) const
+    {
+      return _positionAt( _highPriorityVersionedObject.getVersionAt(forDate),
+                          _lowrPriorityVersionedObject.getVersionAt(forDate) );
+    }
+
+    // same as VersionedObject::getVersionBefore() on the merge result : last version before 'forDate', or end()
+    inline const_iterator getVersionBefore(const t_versionDate& forDate) const
+    {
+      return _positionAt( _highPriorityVersionedObject.getVersionBefore(forDate),
+                          _lowrPriorityVersionedObject.getVersionBefore(forDate) );
+    }
+
+  private:
+    const t_versionedObject& _highPriorityVersionedObject;
+    const t_versionedObject& _lowrPriorityVersionedObject;
+
+    inline const t_datasetLedger& _highLedger() const { return _highPriorityVersionedObject.getDatasetLedger(); }
+    inline const t_datasetLedger& _lowrLedger() const { return _lowrPriorityVersionedObject.getDatasetLedger(); }
+
+    inline const_iterator _makeIterator(typename t_datasetLedger::const_iterator highIter,
+                                        typename t_datasetLedger::const_iterator lowrIter) const
+    {
+      return const_iterator{highIter, _highLedger().cend(), lowrIter, _lowrLedger().cend()};
+    }
+
+    /*
+     * 'highFound' and 'lowrFound' : each source's last version up to the query date ( or cend() ).
+     * The merged version is the later of the two; each source is positioned on its first version
+     * not before that date, which is 'found' itself or the one after it.
+     */
+    const_iterator _positionAt(typename t_datasetLedger::const_iterator highFound,
+                               typename t_datasetLedger::const_iterator lowrFound) const
+    {
+      const bool hasHigh = highFound != _highLedger().cend();
+      const bool hasLowr = lowrFound != _lowrLedger().cend();
+      if(!hasHigh && !hasLowr)
+      {
+        return end();
+      }
+      const t_versionDate& mergedDate = ( !hasLowr || ( hasHigh && !(highFound->first < lowrFound->first) ) ) ?
+                                        highFound->first : lowrFound->first;
+      auto positionOn = [&mergedDate](typename t_datasetLedger::const_iterator found, bool hasFound,
+                                      const t_datasetLedger& ledger)
+      {
+        if(!hasFound) return ledger.cbegin();
+        return found->first < mergedDate ? std::next(found) : found;
+      };
+      return _makeIterator( positionOn(highFound, hasHigh, _highLedger()),
+                            positionOn(lowrFound, hasLowr, _lowrLedger()) );
+    }
+  };
+
+} }   //  namespace datastructure::versionedObject
@@ -46,6 +46,7 @@ namespace datastructure { namespace versionedObject
     using t_record         = typename t_dataset::t_record;
 
     VersionedObjectStream(const VersionedObject<VDT, MT...>& vo) :
+          _versionedObject(vo),
           _datasetLedger(vo.getDatasetLedger()) {}
 
     static VersionedObjectStream createVOstreamer(const VersionedObject<VDT, MT...>& vo)
@@ -56,7 +57,7 @@ namespace datastructure { namespace versionedObject
     template<typename SH = StreamerHelper>
     inline void toCSV(const std::string& prefix, std::ostream& oss, const SH& streamerHelper = SH{}) const
     {
-      for(auto iter : _datasetLedger)
+      for(const auto& iter : _datasetLedger)
       {
         const t_versionDate& versionDate = iter.first;
         const t_dataset& dataset = iter.second;
@@ -69,7 +70,7 @@ namespace datastructure { namespace versionedObject
     template<typename SH = StreamerHelper>
     inline void toCSV(std::ostream& oss, const SH& streamerHelper = SH{}) const
     {
-      for(auto iter : _datasetLedger)
+      for(const auto& iter : _datasetLedger)
       {
         const t_versionDate& versionDate = iter.first;
         oss << versionDate << streamerHelper.getDelimiterCSV();
@@ -90,10 +91,36 @@ namespace datastructure { namespace versionedObject
       return oss.str();
     }
 
+    // change-feed : only versions with versionDate >= 'watermark'
+    template<typename SH = StreamerHelper>
+    inline void toCSVFrom(const t_versionDate& watermark, const std::string& prefix,
+                          std::ostream& oss, const SH& streamerHelper = SH{}) const
+    {
+      for(auto iter = _versionedObject.getVersionsFrom(watermark); iter != _datasetLedger.cend(); ++iter)
+      {
+        oss << prefix << iter->first << streamerHelper.getDelimiterCSV();
+        iter->second.toCSV(oss, streamerHelper);
+        oss << std::endl;
+      }
+    }
+
+    // change-feed : only versions inserted after generation 'sinceGeneration'
+    template<typename SH = StreamerHelper>
+    inline void toCSVSince(typename VersionedObject<VDT, MT...>::t_generation sinceGeneration, const std::string& prefix,
+                           std::ostream& oss, const SH& streamerHelper = SH{}) const
+    {
+      for(const auto& iter : _versionedObject.getVersionsInsertedSince(sinceGeneration))
+      {
+        oss << prefix << iter->first << streamerHelper.getDelimiterCSV();
+        iter->second.toCSV(oss, streamerHelper);
+        oss << std::endl;
+      }
+    }
+
     template<typename SH = StreamerHelper>
     inline void toStr(const std::string& prefix, std::ostream& oss, const SH& streamerHelper = SH{}) const
     {
-      for(auto iter : _datasetLedger)
+      for(const auto& iter : _datasetLedger)
       {
         const t_versionDate& versionDate = iter.first;
         const t_dataset& dataset = iter.second;
@@ -106,7 +133,7 @@ namespace datastructure { namespace versionedObject
     template<typename SH = StreamerHelper>
     inline void toStr(std::ostream& oss, const SH& streamerHelper = SH{}) const
     {
-      for(auto iter : _datasetLedger)
+      for(const auto& iter : _datasetLedger)
       {
         const t_versionDate& versionDate = iter.first;
         oss << "versionDate=" << versionDate << ", dataSet={";
@@ -128,7 +155,8 @@ namespace datastructure { namespace versionedObject
     }
 
   protected:
-    const t_datasetLedger&  _datasetLedger;
+    const VersionedObject<VDT, MT...>&  _versionedObject;
+    const t_datasetLedger&              _datasetLedger;
 
   };
 
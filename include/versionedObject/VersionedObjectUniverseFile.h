@@ -0,0 +1,265 @@
+/*
+ * VersionedObjectUniverseFile.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <filesystem>
+#include <system_error>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/VersionedObjectCodec.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  using VO_UniverseFile_exception = VO_exception<13>;
+
+  /*
+   * Universe file : all VersionedObject's of a universe, with a header index for random access.
+   *
+   * file-layout :
+   *     MAGIC                                                     8 bytes
+   *     [u32 objectCount][u64 indexLength]
+   *     index   { [objectKey][u64 offset][u64 length][u32 checksum] } ...   sorted by objectKey
+   *     blobs   { [VersionedObject] } ...                         offset is from start of file
+   *
+   * The index is read once when the reader is opened; load() then seeks directly to a single
+   * object's blob, so the cost of a point lookup is independent of the size of the universe.
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectUniverseFile
+  {
+  public:
+    using t_versionDate      = VDT;
+    using t_versionedObject  = VersionedObject<VDT, MT...>;
+    using t_universe         = std::map<std::string, t_versionedObject>;
+
+    inline static const std::string MAGIC{"VOUNIV01"};
+    static constexpr size_t FIXED_HEADER_SIZE = 8 /*MAGIC*/ + sizeof(uint32_t) + sizeof(uint64_t);
+
+    struct t_blobLocation
+    {
+      uint64_t  offset;
+      uint64_t  length;
+      uint32_t  checksum;
+    };
+
+    static void write(const std::filesystem::path& universePath, const t_universe& universe)
+    {
+      std::vector<std::string> blobs;
+      blobs.reserve(universe.size());
+      size_t indexLength = 0;
+      for(const auto& [objectKey, vo] : universe)
+      {
+        blobs.emplace_back();
+        binaryEncode(blobs.back(), vo);
+        indexLength += sizeof(uint32_t) + objectKey.size() + 2*sizeof(uint64_t) + sizeof(uint32_t);
+      }
+
+      std::string header{MAGIC};
+      BinaryWriter bw{header};
+      bw.putUnsigned(static_cast<uint32_t>(universe.size()));
+      bw.putUnsigned(static_cast<uint64_t>(indexLength));
+      uint64_t offset = FIXED_HEADER_SIZE + indexLength;
+      size_t   iii    = 0;
+      for(const auto& [objectKey, vo] : universe)
+      {
+        const std::string& blob = blobs[iii++];
+        BinaryCodec<std::string>::encode(bw, objectKey);
+        bw.putUnsigned(offset);
+        bw.putUnsigned(static_cast<uint64_t>(blob.size()));
+        bw.putUnsigned(checksumFNV1a(blob.data(), blob.size()));
+        offset += blob.size();
+      }
+
+      /*
+       * written and fsync'ed to a side file, renamed over the target, then the directory is fsync'ed :
+       * after a crash the target is either the old or the new universe file, never a torn one
+       */
+      std::filesystem::path tempPath{universePath};
+      tempPath += ".tmp";
+      std::FILE* tempFile = std::fopen(tempPath.string().c_str(), "wb");
+      bool isWritten = (tempFile != nullptr) &&
+                       std::fwrite(header.data(), 1, header.size(), tempFile) == header.size();
+      for(size_t blobIdx = 0; isWritten && blobIdx < blobs.size(); ++blobIdx)
+      {
+        isWritten = std::fwrite(blobs[blobIdx].data(), 1, blobs[blobIdx].size(), tempFile) == blobs[blobIdx].size();
+      }
+      isWritten = isWritten && std::fflush(tempFile) == 0 && _syncFile(tempFile);
+      if(tempFile != nullptr && std::fclose(tempFile) != 0)
+      {
+        isWritten = false;
+      }
+      if(!isWritten)
+      {
+        std::error_code ec;
+        std::filesystem::remove(tempPath, ec);
+        throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::write() : write failed for '" + universePath.string() + "'");
+      }
+      std::filesystem::rename(tempPath, universePath);
+      if(!_syncDirectory(universePath.parent_path()))
+      {
+        throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::write() : fsync of the directory failed for '" + universePath.string() + "'");
+      }
+    }
+
+  private:
+    static bool _syncFile(std::FILE* file)
+    {
+#ifndef _WIN32
+      return ::fsync(::fileno(file)) == 0;
+#else
+      return ::_commit(::_fileno(file)) == 0;
+#endif
+    }
+
+    // makes a rename in 'dirPath' durable; not applicable on windows
+    static bool _syncDirectory(const std::filesystem::path& dirPath)
+    {
+#ifndef _WIN32
+      const int dirFd = ::open(dirPath.empty() ? "." : dirPath.c_str(), O_RDONLY);
+      if(dirFd < 0)
+      {
+        return false;
+      }
+      const bool isSynced = (::fsync(dirFd) == 0);
+      ::close(dirFd);
+      return isSynced;
+#else
+      (void)dirPath;
+      return true;
+#endif
+    }
+
+  public:
+    class Reader
+    {
+    public:
+      Reader(const std::filesystem::path& universePath)
+        : _universePath(universePath),
+          _ifs(universePath, std::ios::binary),
+          _index()
+      {
+        if(!_ifs)
+        {
+          throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::Reader() : unable to open '" + _universePath.string() + "'");
+        }
+        _readIndex();
+      }
+
+      Reader() = delete;
+      Reader(Reader const&) = delete;
+      Reader& operator=(Reader const&) = delete;
+
+      inline bool contains(const std::string& objectKey) const { return _index.find(objectKey) != _index.end(); }
+      inline size_t size() const { return _index.size(); }
+      inline const std::map<std::string, t_blobLocation>& getIndex() const { return _index; }
+
+      /*
+       * materializes a single object; returns false if objectKey is not in the universe.
+       * Any versions already in 'vo' are discarded, 'vo' holds exactly the stored object afterwards.
+       */
+      bool load(const std::string& objectKey, t_versionedObject& vo)
+      {
+        typename std::map<std::string, t_blobLocation>::const_iterator iter = _index.find(objectKey);
+        if(iter == _index.end())
+          return false;
+
+        const t_blobLocation& location = iter->second;
+        std::string blob(location.length, '\0');
+        _ifs.clear();
+        _ifs.seekg(static_cast<std::streamoff>(location.offset));
+        _ifs.read(blob.data(), static_cast<std::streamsize>(blob.size()));
+        if(!_ifs || checksumFNV1a(blob.data(), blob.size()) != location.checksum)
+        {
+          throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::Reader::load() : corrupt blob for objectKey '" + objectKey + "'");
+        }
+
+        // decoded aside : a corrupt blob leaves 'vo' untouched
+        t_versionedObject decodedVO;
+        BinaryReader br{blob.data(), blob.size()};
+        BinaryCodec<t_versionedObject>::decodeInto(br, decodedVO);
+
+        typename t_versionedObject::t_datasetLedger decodedLedger = decodedVO.releaseLedger();
+        vo.reserveVersions(decodedLedger.size());
+        vo.clear();
+        while(!decodedLedger.empty())
+        {
+          vo.appendVersion(decodedLedger.extract(decodedLedger.begin()));   // spliced in versionDate order
+        }
+        return true;
+      }
+
+      void loadAll(t_universe& universe)
+      {
+        for(const auto& entry : _index)
+          load(entry.first, universe[entry.first]);
+      }
+
+    private:
+      const std::filesystem::path             _universePath;
+      std::ifstream                           _ifs;
+      std::map<std::string, t_blobLocation>   _index;
+
+      void _readIndex()
+      {
+        std::string fixedHeader(FIXED_HEADER_SIZE, '\0');
+        _ifs.read(fixedHeader.data(), static_cast<std::streamsize>(fixedHeader.size()));
+        if(!_ifs || fixedHeader.compare(0, MAGIC.size(), MAGIC) != 0)
+        {
+          throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::Reader() : '" + _universePath.string() + "' is not a universe file");
+        }
+        BinaryReader hr{fixedHeader.data() + MAGIC.size(), FIXED_HEADER_SIZE - MAGIC.size()};
+        const uint32_t objectCount = hr.getUnsigned<uint32_t>();
+        const uint64_t indexLength = hr.getUnsigned<uint64_t>();
+
+        const uintmax_t fileSize = std::filesystem::file_size(_universePath);
+        if(FIXED_HEADER_SIZE + indexLength > fileSize)
+        {
+          throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::Reader() : corrupt index in '" + _universePath.string() + "'");
+        }
+        std::string indexBuffer(indexLength, '\0');
+        _ifs.read(indexBuffer.data(), static_cast<std::streamsize>(indexBuffer.size()));
+
+        BinaryReader ir{indexBuffer.data(), indexBuffer.size()};
+        for(uint32_t iii = 0; iii < objectCount; ++iii)
+        {
+          std::string objectKey = BinaryCodec<std::string>::decode(ir);
+          t_blobLocation location;
+          location.offset   = ir.getUnsigned<uint64_t>();
+          location.length   = ir.getUnsigned<uint64_t>();
+          location.checksum = ir.getUnsigned<uint32_t>();
+          if(location.offset + location.length > fileSize)
+          {
+            throw VO_UniverseFile_exception("ERROR : VersionedObjectUniverseFile::Reader() : index entry '" + objectKey + "' is beyond end of file");
+          }
+          _index.emplace_hint(_index.end(), std::move(objectKey), location);
+        }
+      }
+    };
+  };
+
+} }   //  namespace datastructure::versionedObject
@@ -0,0 +1,182 @@
+/*
+ * VersionedObjectUniverseMerge.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/VersionedObjectParallel.h>
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  template <typename KEY>
+  struct UniverseMergeReport
+  {
+    size_t                                    mergedObjects  = 0;
+    size_t                                    mergedVersions = 0;  // versions held by the merged objects
+    std::chrono::nanoseconds                  elapsed{0};
+    std::vector<std::pair<KEY, std::string>>  failures{};          // ( objectKey, error message ), in key order
+
+    inline double objectsPerSecond()  const { return _perSecond(mergedObjects); }
+    inline double versionsPerSecond() const { return _perSecond(mergedVersions); }
+
+  private:
+    inline double _perSecond(size_t count) const
+    {
+      return elapsed.count() == 0 ? 0.0 : double(count) * 1e9 / double(elapsed.count());
+    }
+  };
+
+  /*
+   * VersionedObjectPriorityMerge over two universes ( objectKey -> VersionedObject ), one
+   * independent merge per key of either universe, run on 'threadCount' workers
+   * ( see parallelForChunks() ). A key present in one universe only is merged with an empty object.
+   *
+   * A key whose merge fails on its data ( different records at a date, or metaData that cannot be
+   * mergeVersion()'d ) is reported in UniverseMergeReport::failures and the other keys carry on.
+   * The failed key is not added to 'mergeUniverse'; if it was already there, it is left as
+   * getMergeResult() left it. Any other exception is rethrown once the workers have joined.
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectUniversePriorityMerge
+  {
+  public:
+    using t_versionDate      = VDT;
+    using t_versionedObject  = VersionedObject<VDT, MT...>;
+    using t_versionedObjectPriorityMerge = VersionedObjectPriorityMerge<VDT, MT...>;
+
+    // 'chunksPerThread' > 1 balances the load when object sizes are skewed
+    static constexpr size_t DEFAULT_CHUNKS_PER_THREAD = 8;
+
+    // threadCount = 0 -> one thread per hardware core
+    template<typename KEY, typename CMP, typename ALLOC>
+    static UniverseMergeReport<KEY> merge(const std::map<KEY, t_versionedObject, CMP, ALLOC>& highPriorityUniverse,
+                                          const std::map<KEY, t_versionedObject, CMP, ALLOC>& lowrPriorityUniverse,
+                                          std::map<KEY, t_versionedObject, CMP, ALLOC>& mergeUniverse,
+                                          size_t threadCount = 0, size_t chunksPerThread = DEFAULT_CHUNKS_PER_THREAD)
+    {
+      using t_clock = std::chrono::steady_clock;
+      using t_universeIter = typename std::map<KEY, t_versionedObject, CMP, ALLOC>::iterator;
+
+      const auto mergeStart = t_clock::now();
+      UniverseMergeReport<KEY> report;
+
+      // the map nodes of 'mergeUniverse' are created up-front, workers only write into their own objects
+      const t_versionedObject emptyVersionedObject;
+      std::vector<_MergeTask<t_universeIter>> mergeTasks;
+      // reserved, so that every node created by try_emplace() gets its task recorded
+      mergeTasks.reserve(highPriorityUniverse.size() + lowrPriorityUniverse.size());
+      size_t chunkCount = 0;
+      std::vector<std::vector<std::pair<KEY, std::string>>> chunkFailures;
+      std::vector<size_t> chunkVersions;
+      try {
+        auto highIter = highPriorityUniverse.cbegin();
+        auto lowrIter = lowrPriorityUniverse.cbegin();
+        const CMP keyLessCompare = highPriorityUniverse.key_comp();
+        while(highIter != highPriorityUniverse.cend() || lowrIter != lowrPriorityUniverse.cend())
+        {
+          const bool takeHigh = lowrIter == lowrPriorityUniverse.cend() ||
+                                ( highIter != highPriorityUniverse.cend() && !keyLessCompare(lowrIter->first, highIter->first) );
+          const bool takeLowr = highIter == highPriorityUniverse.cend() ||
+                                ( lowrIter != lowrPriorityUniverse.cend() && !keyLessCompare(highIter->first, lowrIter->first) );
+          const KEY& objectKey = takeHigh ? highIter->first : lowrIter->first;
+          const auto [ mergeIter, created ] = mergeUniverse.try_emplace(objectKey);
+          mergeTasks.push_back({ takeHigh ? &(highIter->second) : &emptyVersionedObject,
+                                 takeLowr ? &(lowrIter->second) : &emptyVersionedObject,
+                                 mergeIter, created, false });
+          if(takeHigh) ++highIter;
+          if(takeLowr) ++lowrIter;
+        }
+
+        threadCount = resolveThreadCount(threadCount);
+        chunkCount = std::min(mergeTasks.size(), threadCount * std::max<size_t>(chunksPerThread, 1));
+        chunkFailures.resize(chunkCount);
+        chunkVersions.resize(chunkCount, 0);
+
+        parallelForChunks(mergeTasks.size(), chunkCount, threadCount,
+          [&mergeTasks, &chunkFailures, &chunkVersions](size_t chunkIdx, size_t beginIdx, size_t endIdx)
+          {
+            for(size_t idx = beginIdx; idx < endIdx; ++idx)
+            {
+              _MergeTask<t_universeIter>& mergeTask = mergeTasks[idx];
+              t_versionedObject& mergeVersionedObject = mergeTask.mergeIter->second;
+              try {
+                t_versionedObjectPriorityMerge{*mergeTask.highPriority, *mergeTask.lowrPriority}.getMergeResult(mergeVersionedObject);
+                chunkVersions[chunkIdx] += mergeVersionedObject.getDatasetLedger().size();
+              } catch (const VOPM_Record_Mismatch_exception& err) {
+                _failed(mergeTask, err, chunkFailures[chunkIdx]);
+              } catch (const VO_Record_Mismatch_exception& err) {
+                _failed(mergeTask, err, chunkFailures[chunkIdx]);
+              } catch (const MergeError_MetaDataSource_exception& err) {
+                _failed(mergeTask, err, chunkFailures[chunkIdx]);
+              }
+            }
+          });
+      } catch (...) {
+        // not a data error (eg: bad_alloc) : drop the objects this merge created, then rethrow
+        for(const _MergeTask<t_universeIter>& mergeTask : mergeTasks)
+        {
+          if(mergeTask.created)
+            mergeUniverse.erase(mergeTask.mergeIter);
+        }
+        throw;
+      }
+
+      for(const _MergeTask<t_universeIter>& mergeTask : mergeTasks)
+      {
+        if(!mergeTask.failed)
+        {
+          ++report.mergedObjects;
+        } else if(mergeTask.created) {
+          mergeUniverse.erase(mergeTask.mergeIter);
+        }
+      }
+      for(size_t chunkIdx = 0; chunkIdx < chunkCount; ++chunkIdx)
+      {
+        report.mergedVersions += chunkVersions[chunkIdx];
+        std::move(chunkFailures[chunkIdx].begin(), chunkFailures[chunkIdx].end(), std::back_inserter(report.failures));
+      }
+      report.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(t_clock::now() - mergeStart);
+      return report;
+    }
+
+  private:
+    template<typename ITER>
+    struct _MergeTask
+    {
+      const t_versionedObject*  highPriority;
+      const t_versionedObject*  lowrPriority;
+      ITER                      mergeIter;
+      bool                      created;
+      bool                      failed;
+    };
+
+    template<typename ITER, typename KEY>
+    static inline void _failed(_MergeTask<ITER>& mergeTask, const std::exception& err,
+                               std::vector<std::pair<KEY, std::string>>& failures)
+    {
+      mergeTask.failed = true;
+      failures.emplace_back(mergeTask.mergeIter->first, err.what());
+    }
+  };
+
+} }   //  namespace datastructure::versionedObject
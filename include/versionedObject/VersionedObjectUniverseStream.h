@@ -0,0 +1,205 @@
+/*
+ * VersionedObjectUniverseStream.h
+ *
+ * URL:      https://github.com/panchaBhuta/dataStructure
+ * Version:  v3.5
+ *
+ * Copyright (C) 2023-2025 Gautam Dhar
+ * All rights reserved.
+ *
+ * dataStructure is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <condition_variable>
+#include <fstream>
+#include <filesystem>
+
+#include <versionedObject/VersionedObject.h>
+#include <versionedObject/VersionedObjectStream.h>
+#include <versionedObject/VersionedObjectParallel.h>
+
+
+namespace datastructure { namespace versionedObject
+{
+  using VO_UniverseStream_IO_exception = VO_exception<16>;
+
+  /*
+   * Export of a universe ( objectKey -> VersionedObject ). Each version is written as
+   *     objectKey<delimCSV>versionDate<delimCSV>dataset.toCSV()
+   * i.e. VersionedObjectStream::toCSV(prefix,...) with "objectKey<delimCSV>" as prefix, objects in key order.
+   *
+   * toCSV() formats contiguous key-ranges into per-chunk buffers on worker threads. A chunk is
+   * written as soon as it and every chunk before it are formatted, by whichever worker completes
+   * that run, while the other workers keep formatting. At most 'IN_FLIGHT_CHUNKS_PER_THREAD' chunks
+   * per thread are buffered at a time, so memory does not grow with the size of the export.
+   * Chunks are written in key order : the output is byte-identical to toCSVSequential().
+   */
+  template <typename VDT, typename ... MT>
+  class VersionedObjectUniverseStream
+  {
+  public:
+    using t_versionDate      = VDT;
+    using t_versionedObject  = VersionedObject<VDT, MT...>;
+    using t_versionObjectStream = VersionedObjectStream<VDT, MT...>;
+
+    // 'chunksPerThread' > 1 balances the load when object sizes are skewed
+    static constexpr size_t DEFAULT_CHUNKS_PER_THREAD = 8;
+    static constexpr size_t IN_FLIGHT_CHUNKS_PER_THREAD = 2;
+
+    template<typename KEY, typename CMP, typename ALLOC, typename SH = StreamerHelper>
+    static void toCSVSequential(const std::map<KEY, t_versionedObject, CMP, ALLOC>& universe,
+                                std::ostream& oss, const SH& streamerHelper = SH{})
+    {
+      for(const auto& [objectKey, vo] : universe)
+      {
+        _objectToCSV(objectKey, vo, oss, streamerHelper);
+      }
+    }
+
+    // threadCount = 0 -> one thread per hardware core
+    template<typename KEY, typename CMP, typename ALLOC, typename SH = StreamerHelper>
+    static void toCSV(const std::map<KEY, t_versionedObject, CMP, ALLOC>& universe,
+                      std::ostream& oss, const SH& streamerHelper = SH{},
+                      size_t threadCount = 0, size_t chunksPerThread = DEFAULT_CHUNKS_PER_THREAD)
+    {
+      using t_universeIter = typename std::map<KEY, t_versionedObject, CMP, ALLOC>::const_iterator;
+      std::vector<t_universeIter> objects;
+      objects.reserve(universe.size());
+      for(t_universeIter iter = universe.cbegin(); iter != universe.cend(); ++iter)
+        objects.push_back(iter);
+
+      threadCount = resolveThreadCount(threadCount);
+      const size_t chunkCount = std::min(objects.size(), threadCount * std::max<size_t>(chunksPerThread, 1));
+      if(chunkCount == 0)
+        return;
+
+      // chunk 'chunkIdx' is buffered in slot 'chunkIdx % windowSize', once 'chunkIdx < nextToWrite + windowSize'
+      const size_t windowSize = std::min(chunkCount, threadCount * IN_FLIGHT_CHUNKS_PER_THREAD);
+      std::vector<std::string> windowBuffers(windowSize);
+      std::vector<char>        isFormatted(windowSize, false);
+      size_t                   nextToWrite = 0;
+      bool                     isWriting   = false;   // one worker writes to 'oss' at a time
+      bool                     isFailed    = false;
+      std::mutex               windowMutex;
+      std::condition_variable  windowCv;
+
+      parallelForChunks(objects.size(), chunkCount, threadCount,
+        [&](size_t chunkIdx, size_t beginIdx, size_t endIdx)
+        {
+          {
+            std::unique_lock<std::mutex> lock(windowMutex);
+            windowCv.wait(lock, [&]() { return chunkIdx < nextToWrite + windowSize || isFailed; });
+            if(isFailed)
+              return;
+          }
+
+          std::string chunkBuffer;
+          try {
+            std::ostringstream chunkStream;
+            for(size_t idx = beginIdx; idx < endIdx; ++idx)
+              _objectToCSV(objects[idx]->first, objects[idx]->second, chunkStream, streamerHelper);
+            chunkBuffer = std::move(chunkStream).str();
+          } catch (...) {
+            {
+              std::lock_guard<std::mutex> lock(windowMutex);
+              isFailed = true;   // releases the workers waiting on the window
+            }
+            windowCv.notify_all();
+            throw;
+          }
+
+          std::unique_lock<std::mutex> lock(windowMutex);
+          windowBuffers[chunkIdx % windowSize] = std::move(chunkBuffer);
+          isFormatted[chunkIdx % windowSize] = true;
+          if(isWriting)
+            return;   // the running writer picks it up
+          isWriting = true;
+          while(!isFailed && nextToWrite < chunkCount && isFormatted[nextToWrite % windowSize])
+          {
+            const size_t slot = nextToWrite % windowSize;
+            const std::string buffer = std::move(windowBuffers[slot]);
+            isFormatted[slot] = false;
+            lock.unlock();
+            oss.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            lock.lock();
+            ++nextToWrite;
+            windowCv.notify_all();
+          }
+          isWriting = false;
+        });
+    }
+
+    template<typename KEY, typename CMP, typename ALLOC, typename SH = StreamerHelper>
+    static void toCSVFile(const std::map<KEY, t_versionedObject, CMP, ALLOC>& universe,
+                          const std::filesystem::path& exportPath, const SH& streamerHelper = SH{},
+                          size_t threadCount = 0, size_t chunksPerThread = DEFAULT_CHUNKS_PER_THREAD)
+    {
+      std::ofstream ofs(exportPath, std::ios::binary | std::ios::trunc);
+      if(!ofs)
+      {
+        throw VO_UniverseStream_IO_exception("ERROR : VersionedObjectUniverseStream::toCSVFile() : unable to open '" + exportPath.string() + "'");
+      }
+      toCSV(universe, ofs, streamerHelper, threadCount, chunksPerThread);
+      ofs.flush();
+      if(!ofs)
+      {
+        throw VO_UniverseStream_IO_exception("ERROR : VersionedObjectUniverseStream::toCSVFile() : write failed for '" + exportPath.string() + "'");
+      }
+    }
+
+    /*
+     * change-feed of a universe, same line format as toCSV().
+     * toCSVFrom()  : versions with versionDate >= 'watermark'
+     * toCSVSince() : versions inserted after 'sinceGeneration'; pass t_versionedObject::getGeneration()
+     *                taken at the previous pull, so that the feed is proportional to what changed.
+     *                Every object of the universe has to be change tracked.
+     */
+    template<typename KEY, typename CMP, typename ALLOC, typename SH = StreamerHelper>
+    static void toCSVFrom(const std::map<KEY, t_versionedObject, CMP, ALLOC>& universe, const VDT& watermark,
+                          std::ostream& oss, const SH& streamerHelper = SH{})
+    {
+      for(const auto& [objectKey, vo] : universe)
+      {
+        t_versionObjectStream::createVOstreamer(vo).toCSVFrom(watermark, _prefix(objectKey, streamerHelper),
+                                                               oss, streamerHelper);
+      }
+    }
+
+    template<typename KEY, typename CMP, typename ALLOC, typename SH = StreamerHelper>
+    static void toCSVSince(const std::map<KEY, t_versionedObject, CMP, ALLOC>& universe,
+                           typename t_versionedObject::t_generation sinceGeneration,
+                           std::ostream& oss, const SH& streamerHelper = SH{})
+    {
+      for(const auto& [objectKey, vo] : universe)
+      {
+        t_versionObjectStream::createVOstreamer(vo).toCSVSince(sinceGeneration, _prefix(objectKey, streamerHelper),
+                                                                oss, streamerHelper);
+      }
+    }
+
+  private:
+    template<typename KEY, typename SH>
+    static inline std::string _prefix(const KEY& objectKey, const SH& streamerHelper)
+    {
+      std::ostringstream prefix;
+      prefix << objectKey << streamerHelper.getDelimiterCSV();
+      return prefix.str();
+    }
+
+    template<typename KEY, typename SH>
+    static inline void _objectToCSV(const KEY& objectKey, const t_versionedObject& vo,
+                                    std::ostream& oss, const SH& streamerHelper)
+    {
+      t_versionObjectStream::createVOstreamer(vo).toCSV(_prefix(objectKey, streamerHelper), oss, streamerHelper);
+    }
+  };
+
+} }   //  namespace datastructure::versionedObject
@@ -0,0 +1,431 @@
+
+// perf test : ordered (std::map) vs unordered (hash-table) vs single-storage BiMap, lookups of symbol <-> ISIN
+
+#include <new>
+#include <set>
+#include <map>
+#include <atomic>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+
+#include <biMap/BiMap.h>
+#include <biMap/UnorderedBiMap.h>
+#include <biMap/SingleStorageBiMap.h>
+#include <biMap/FrozenBiMap.h>
+#include <biMap/SmallSortedSet.h>
+#include <biMap/ManyToManyBiMap.h>
+
+namespace dsbm = datastructure::bimap;
+
+
+// heap bytes requested, to compare the memory footprint of the bimaps
+std::atomic<size_t> g_allocatedBytes{0};
+
+void* operator new(size_t size)
+{
+  g_allocatedBytes += size;
+  if(void* ptr = std::malloc(size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+// gcc pairs the replaced operator new with the builtin one when inlining, and flags the free()
+#if defined(__GNUC__) && !defined(__clang__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+  #pragma GCC diagnostic pop
+#endif
+
+
+// FNV-1a over the characters, ISINs share long common prefixes which hurts std::less<std::string>
+struct IsinHash
+{
+  inline size_t operator()(const std::string& isin) const noexcept
+  {
+    uint64_t hash = 14695981039346656037ull;
+    for(const char ch : isin)
+    {
+      hash ^= static_cast<unsigned char>(ch);
+      hash *= 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+std::string makeSymbol(size_t idx)
+{
+  return "SYM" + std::to_string(idx);
+}
+
+std::string makeIsin(size_t idx)
+{
+  std::string digits = std::to_string(idx);
+  return "INE" + std::string(9 - std::min<size_t>(digits.size(), 9), '0') + digits;
+}
+
+template<typename BIMAP>
+void benchmark(const std::string& label, BIMAP& biMap, size_t keyCount, const std::vector<size_t>& probes)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  std::vector<std::string> lefttKeys, rightKeys;
+  lefttKeys.reserve(keyCount);
+  rightKeys.reserve(keyCount);
+  for(size_t idx = 0; idx < keyCount; ++idx)
+  {
+    lefttKeys.push_back(makeSymbol(idx));
+    rightKeys.push_back(makeIsin(idx));
+  }
+
+  const size_t bytesBefore = g_allocatedBytes;
+  const auto insertStart = t_clock::now();
+  for(size_t idx = 0; idx < keyCount; ++idx)
+    biMap.insert_left(lefttKeys[idx], rightKeys[idx]);
+  const auto insertEnd = t_clock::now();
+  const double bytesPerKey = double(g_allocatedBytes - bytesBefore) / double(keyCount);
+
+  std::vector<std::string> symbols, isins;
+  symbols.reserve(probes.size());
+  isins.reserve(probes.size());
+  for(const size_t idx : probes)
+  {
+    symbols.push_back(makeSymbol(idx));
+    isins.push_back(makeIsin(idx));
+  }
+
+  size_t hits = 0;
+  const auto findStart = t_clock::now();
+  for(size_t iii = 0; iii < probes.size(); ++iii)
+  {
+    auto lefttIter = biMap.find_left(symbols[iii]);
+    auto rightIter = biMap.find_right(isins[iii]);
+    hits += (biMap.isLeft_end(lefttIter) ? 0u : 1u) + (biMap.isRight_end(rightIter) ? 0u : 1u);
+  }
+  const auto findEnd = t_clock::now();
+
+  const double insertNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(insertEnd - insertStart).count()) / double(keyCount);
+  const double findNs   = double(std::chrono::duration_cast<std::chrono::nanoseconds>(findEnd - findStart).count()) / double(2 * probes.size());
+  std::cout << std::left << std::setw(40) << label << std::right
+            << std::setw(10) << keyCount
+            << std::setw(14) << std::fixed << std::setprecision(1) << insertNs
+            << std::setw(14) << findNs
+            << std::setw(14) << bytesPerKey
+            << std::setw(10) << hits << std::endl;
+}
+
+// lookups only, the frozen bimap is built from an already filled BiMap
+template<typename FROZEN>
+void benchmarkFrozen(const std::string& label, const FROZEN& frozen, const std::vector<size_t>& probes)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  std::vector<std::string> symbols, isins;
+  symbols.reserve(probes.size());
+  isins.reserve(probes.size());
+  for(const size_t idx : probes)
+  {
+    symbols.push_back(makeSymbol(idx));
+    isins.push_back(makeIsin(idx));
+  }
+
+  size_t hits = 0;
+  const auto findStart = t_clock::now();
+  for(size_t iii = 0; iii < probes.size(); ++iii)
+  {
+    hits += (frozen.find_left(symbols[iii])  == nullptr ? 0u : 1u) +
+            (frozen.find_right(isins[iii]) == nullptr ? 0u : 1u);
+  }
+  const auto findEnd = t_clock::now();
+
+  const double findNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(findEnd - findStart).count()) / double(2 * probes.size());
+  std::cout << std::left << std::setw(40) << label << std::right
+            << std::setw(10) << frozen.size_left()
+            << std::setw(14) << "-"
+            << std::setw(14) << std::fixed << std::setprecision(1) << findNs
+            << std::setw(14) << "-"
+            << std::setw(10) << hits << std::endl;
+}
+
+// find_left_many() over the same probes as benchmark(), one batch
+template<typename BIMAP>
+void benchmarkBatchedFind(const std::string& label, const BIMAP& biMap, const std::vector<size_t>& probes)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  std::vector<std::string> symbols;
+  symbols.reserve(probes.size());
+  for(const size_t idx : probes)
+    symbols.push_back(makeSymbol(idx));
+
+  const auto findStart = t_clock::now();
+  auto found = biMap.find_left_many(std::span<const std::string>(symbols));
+  const auto findEnd = t_clock::now();
+
+  size_t hits = 0;
+  for(auto& lefttIter : found)
+    hits += biMap.isLeft_end(lefttIter) ? 0u : 1u;
+
+  const double findNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(findEnd - findStart).count()) / double(probes.size());
+  std::cout << std::left << std::setw(40) << label << std::right
+            << std::setw(10) << biMap.size_left()
+            << std::setw(14) << "-"
+            << std::setw(14) << std::fixed << std::setprecision(1) << findNs
+            << std::setw(14) << "-"
+            << std::setw(10) << hits << std::endl;
+}
+
+// bulk load with insert_sorted(), then a corporate-action batch of symbol renames applied in place
+void benchmarkSortedLoadAndRekey(size_t keyCount, size_t batchSize)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  std::vector<std::pair<std::string, std::string>> sortedPairs;
+  sortedPairs.reserve(keyCount);
+  for(size_t idx = 0; idx < keyCount; ++idx)
+    sortedPairs.emplace_back(makeSymbol(idx), makeIsin(idx));
+  std::sort(sortedPairs.begin(), sortedPairs.end());
+
+  dsbm::BiMap_LR11_RL11<std::string, std::string> ordered;
+  const auto loadStart = t_clock::now();
+  const size_t loaded = ordered.insert_sorted(sortedPairs);
+  const auto loadEnd = t_clock::now();
+
+  size_t renamed = 0;
+  const auto rekeyStart = t_clock::now();
+  for(size_t idx = 0; idx < batchSize; ++idx)
+    renamed += ordered.rekey_left(makeSymbol(idx * (keyCount / batchSize)), "NEW" + std::to_string(idx)) ? 1u : 0u;
+  const auto rekeyEnd = t_clock::now();
+
+  const double loadNs  = double(std::chrono::duration_cast<std::chrono::nanoseconds>(loadEnd - loadStart).count()) / double(keyCount);
+  const double rekeyNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(rekeyEnd - rekeyStart).count()) / double(batchSize);
+  std::cout << std::left << std::setw(40) << "BiMap_LR11_RL11 insert_sorted+rekey" << std::right
+            << std::setw(10) << keyCount
+            << std::setw(14) << std::fixed << std::setprecision(1) << loadNs
+            << std::setw(14) << rekeyNs
+            << std::setw(14) << "-"
+            << std::setw(10) << (loaded + renamed) << std::endl;
+}
+
+// issuer -> 1..3 instruments : heap per left-key, and a full iteration over every many-side set
+template<typename BIMAP>
+void benchmarkManySide(const std::string& label, size_t keyCount)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  std::vector<std::pair<std::string, std::string>> sortedPairs;
+  for(size_t idx = 0; idx < keyCount; ++idx)
+    for(size_t instrument = 0; instrument <= idx % 3; ++instrument)
+      sortedPairs.emplace_back(makeSymbol(idx), makeIsin(idx * 3 + instrument));
+  std::sort(sortedPairs.begin(), sortedPairs.end());
+
+  const size_t bytesBefore = g_allocatedBytes;
+  BIMAP issuerIsins;
+  const auto insertStart = t_clock::now();
+  issuerIsins.insert_sorted(sortedPairs);
+  const auto insertEnd = t_clock::now();
+  const double bytesPerKey = double(g_allocatedBytes - bytesBefore) / double(keyCount);
+
+  size_t visited = 0;
+  const auto iterateStart = t_clock::now();
+  for(int repeat = 0; repeat < 10; ++repeat)
+    for(const auto& [issuer, isins] : issuerIsins.getLefttMap())
+      for(const std::string& isin : isins)
+        visited += isin.size() == 12 ? 1u : 0u;
+  const auto iterateEnd = t_clock::now();
+
+  const double insertNs  = double(std::chrono::duration_cast<std::chrono::nanoseconds>(insertEnd - insertStart).count()) / double(sortedPairs.size());
+  const double iterateNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(iterateEnd - iterateStart).count()) / double(visited);
+  std::cout << std::left << std::setw(40) << label << std::right
+            << std::setw(10) << keyCount
+            << std::setw(14) << std::fixed << std::setprecision(1) << insertNs
+            << std::setw(14) << iterateNs
+            << std::setw(14) << bytesPerKey
+            << std::setw(10) << visited << std::endl;
+}
+
+// index <-> securities, each security in 1..3 of 'indexCount' indices : build, then walk the
+// constituents of every index and the indices of every security
+void benchmarkManyToMany(size_t keyCount, size_t indexCount)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  std::vector<std::pair<std::string, std::string>> indexSecurities;
+  for(size_t idx = 0; idx < keyCount; ++idx)
+    for(size_t member = 0; member <= idx % 3; ++member)
+      indexSecurities.emplace_back("IDX" + std::to_string((idx + member * 7) % indexCount), makeIsin(idx));
+
+  const auto report = [keyCount](const std::string& label, double buildNs, double walkNs, size_t usedBytes, size_t visited)
+                      {
+                        std::cout << std::left << std::setw(40) << label << std::right
+                                  << std::setw(10) << keyCount
+                                  << std::setw(14) << std::fixed << std::setprecision(1) << buildNs
+                                  << std::setw(14) << walkNs
+                                  << std::setw(14) << double(usedBytes) / double(keyCount)
+                                  << std::setw(10) << visited << std::endl;
+                      };
+  const auto elapsedNs = [](t_clock::time_point start, t_clock::time_point end, size_t count)
+                         {
+                           return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / double(count);
+                         };
+
+  {
+    const size_t bytesBefore = g_allocatedBytes;
+    std::map<std::string, std::set<std::string>> indexToSecurities, securityToIndices;
+    const auto buildStart = t_clock::now();
+    for(const auto& [index, security] : indexSecurities)
+    {
+      indexToSecurities[index].insert(security);
+      securityToIndices[security].insert(index);
+    }
+    const auto walkStart = t_clock::now();
+    size_t visited = 0;
+    for(const auto& [index, securities] : indexToSecurities)
+      visited += securities.size();
+    for(const auto& [security, indices] : securityToIndices)
+      visited += indices.size();
+    const auto walkEnd = t_clock::now();
+    report("2 x map<K,set<V>> M:N", elapsedNs(buildStart, walkStart, indexSecurities.size()),
+           elapsedNs(walkStart, walkEnd, visited), g_allocatedBytes - bytesBefore, visited);
+  }
+  {
+    dsbm::BiMap_LRMM_RLMM<std::string, std::string>::Builder builder;
+    const auto buildStart = t_clock::now();
+    for(const auto& [index, security] : indexSecurities)
+      builder.insert(index, security);
+    const auto manyToMany = std::move(builder).build();
+    const auto walkStart = t_clock::now();
+    size_t visited = 0;
+    for(size_t lefttIdx = 0; lefttIdx < manyToMany.size_left(); ++lefttIdx)
+      for(const std::string& security : manyToMany.neighbours_left(lefttIdx))
+        visited += security.empty() ? 0u : 1u;
+    for(size_t rightIdx = 0; rightIdx < manyToMany.size_right(); ++rightIdx)
+      for(const std::string& index : manyToMany.neighbours_right(rightIdx))
+        visited += index.empty() ? 0u : 1u;
+    const auto walkEnd = t_clock::now();
+    report("BiMap_LRMM_RLMM M:N", elapsedNs(buildStart, walkStart, indexSecurities.size()),
+           elapsedNs(walkStart, walkEnd, visited), manyToMany.memory_usage(), visited);
+  }
+}
+
+/*
+ * symbol churn : erase the oldest pair and insert a new one, 'keyCount' times over a map of
+ * 'keyCount' pairs; heap bytes requested per churn
+ */
+void benchmarkChurn(size_t keyCount)
+{
+  using t_clock = std::chrono::steady_clock;
+
+  const auto churn = [keyCount](const std::string& label, auto& biMap, auto&& churnOne)
+                     {
+                       for(size_t idx = 0; idx < keyCount; ++idx)
+                         biMap.insert_left(idx, makeIsin(idx));
+                       const size_t bytesBefore = g_allocatedBytes;
+                       const auto churnStart = t_clock::now();
+                       for(size_t idx = keyCount; idx < 2 * keyCount; ++idx)
+                         churnOne(idx - keyCount, idx);
+                       const auto churnEnd = t_clock::now();
+                       const double churnNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(churnEnd - churnStart).count()) / double(keyCount);
+                       std::cout << std::left << std::setw(40) << label << std::right
+                                 << std::setw(10) << keyCount
+                                 << std::setw(14) << std::fixed << std::setprecision(1) << churnNs
+                                 << std::setw(14) << "-"
+                                 << std::setw(14) << double(g_allocatedBytes - bytesBefore) / double(keyCount)
+                                 << std::setw(10) << biMap.size_left() << std::endl;
+                     };
+  {
+    dsbm::BiMap_LR11_RL11<size_t, std::string> biMap;
+    churn("BiMap_LR11_RL11 churn erase+insert", biMap,
+          [&biMap](size_t oldIdx, size_t newIdx) { biMap.erase_left(oldIdx); biMap.insert_left(newIdx, makeIsin(newIdx)); });
+  }
+  {
+    dsbm::BiMap_LR11_RL11<size_t, std::string> biMap;
+    churn("BiMap_LR11_RL11 churn extract+insert", biMap,
+          [&biMap](size_t oldIdx, size_t newIdx) { auto node = biMap.extract_left(oldIdx);
+                                                    node.rekey(newIdx, makeIsin(newIdx));
+                                                    biMap.insert(std::move(node)); });
+  }
+  {
+    std::pmr::unsynchronized_pool_resource pool;
+    dsbm::pmr::BiMap_LR11_RL11<size_t, std::string> biMap(&pool);
+    churn("pmr::BiMap_LR11_RL11 pool erase+insert", biMap,
+          [&biMap](size_t oldIdx, size_t newIdx) { biMap.erase_left(oldIdx); biMap.insert_left(newIdx, makeIsin(newIdx)); });
+  }
+}
+
+int main()
+{
+  std::cout << std::left << std::setw(40) << "bimap" << std::right
+            << std::setw(10) << "keys"
+            << std::setw(14) << "insert ns/key"
+            << std::setw(14) << "find ns/op"
+            << std::setw(14) << "heap B/key"
+            << std::setw(10) << "hits" << std::endl;
+
+  for(const size_t keyCount : std::vector<size_t>{10000, 1000000})
+  {
+    std::mt19937_64 rng(keyCount);
+    std::uniform_int_distribution<size_t> dist(0, keyCount - 1);
+    std::vector<size_t> probes(1000000);
+    for(size_t& probe : probes)
+      probe = dist(rng);
+
+    {
+      dsbm::BiMap_LR11_RL11<std::string, std::string> ordered;
+      benchmark("BiMap_LR11_RL11", ordered, keyCount, probes);
+      benchmarkBatchedFind("BiMap_LR11_RL11 find_left_many", ordered, probes);
+      benchmarkFrozen("FrozenBiMap_LR11_RL11",
+                      dsbm::FrozenBiMap_LR11_RL11<std::string, std::string>::freeze(ordered), probes);
+    }
+    benchmarkSortedLoadAndRekey(keyCount, 1000);
+    benchmarkChurn(keyCount);
+    {
+      dsbm::SingleStorageBiMap_LR11_RL11<std::string, std::string> singleStorage;
+      benchmark("SingleStorageBiMap_LR11_RL11", singleStorage, keyCount, probes);
+    }
+    {
+      dsbm::UnorderedBiMap_LR11_RL11<std::string, std::string> unordered;
+      benchmark("UnorderedBiMap_LR11_RL11", unordered, keyCount, probes);
+    }
+    {
+      dsbm::UnorderedBiMap_LR11_RL11<std::string, std::string, std::hash<std::string>, IsinHash> unordered;
+      unordered.reserve(keyCount);
+      benchmark("UnorderedBiMap_LR11_RL11<IsinHash>+rsv", unordered, keyCount, probes);
+      benchmarkBatchedFind("UnorderedBiMap_LR11_RL11 find_left_many", unordered, probes);
+    }
+    {
+      dsbm::BiMap_LR1M_RL11<std::string, std::string> ordered;
+      benchmark("BiMap_LR1M_RL11", ordered, keyCount, probes);
+    }
+    benchmarkManySide<dsbm::BiMap_LR1M_RL11<std::string, std::string>>("BiMap_LR1M_RL11 1..3 rights", keyCount);
+    benchmarkManySide<dsbm::SmallSetBiMap_LR1M_RL11<std::string, std::string, 3>>("SmallSetBiMap_LR1M_RL11<3> 1..3 rights", keyCount);
+    benchmarkManyToMany(keyCount, 200);
+    {
+      dsbm::UnorderedBiMap_LR1M_RL11<std::string, std::string, std::hash<std::string>, IsinHash> unordered;
+      unordered.reserve(keyCount, keyCount);
+      benchmark("UnorderedBiMap_LR1M_RL11<IsinHash>+rsv", unordered, keyCount, probes);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+
+// perf test : read throughput of ConcurrentBiMap vs a mutex-guarded BiMap, as reader threads are added
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+
+#include <biMap/BiMap.h>
+#include <biMap/ConcurrentBiMap.h>
+
+namespace dsbm = datastructure::bimap;
+
+using t_biMap = dsbm::BiMap_LR11_RL11<std::string, std::string>;
+
+constexpr size_t keyCount         = 100000;
+constexpr size_t lookupsPerThread = 1000000;
+
+std::string makeSymbol(size_t idx)
+{
+  return "SYM" + std::to_string(idx);
+}
+
+std::string makeIsin(size_t idx)
+{
+  std::string digits = std::to_string(idx);
+  return "INE" + std::string(9 - std::min<size_t>(digits.size(), 9), '0') + digits;
+}
+
+class MutexBiMap
+{
+public:
+  MutexBiMap() : _mutex(), _biMap() {}
+
+  void insert_left(const std::string& lefttKey, const std::string& rightKey)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _biMap.insert_left(lefttKey, rightKey);
+  }
+
+  bool contains(const std::string& lefttKey)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto iter = _biMap.find_left(lefttKey);
+    return !_biMap.isLeft_end(iter);
+  }
+
+private:
+  std::mutex  _mutex;
+  t_biMap     _biMap;
+};
+
+// every reader does 'lookupsPerThread' find_left ; returns million lookups per second, all threads together
+template<typename LOOKUP>
+double measure(unsigned threadCount, const std::vector<std::string>& symbols, LOOKUP lookup)
+{
+  std::atomic<size_t> hits{0};
+  std::vector<std::thread> readers;
+  const auto start = std::chrono::steady_clock::now();
+  for(unsigned thrd = 0; thrd < threadCount; ++thrd)
+  {
+    readers.emplace_back([thrd, &symbols, &hits, &lookup]()
+                         {
+                           std::mt19937_64 rng(thrd);
+                           std::uniform_int_distribution<size_t> dist(0, symbols.size() - 1);
+                           size_t localHits = 0;
+                           for(size_t iii = 0; iii < lookupsPerThread; ++iii)
+                             localHits += lookup(symbols[dist(rng)]) ? 1u : 0u;
+                           hits += localHits;
+                         });
+  }
+  for(std::thread& reader : readers)
+    reader.join();
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if(hits != threadCount * lookupsPerThread)
+    std::cout << "unexpected misses" << std::endl;
+  return double(threadCount * lookupsPerThread) / seconds / 1e6;
+}
+
+int main()
+{
+  std::vector<std::string> symbols;
+  symbols.reserve(keyCount);
+  dsbm::ConcurrentBiMap<t_biMap> concurrentBiMap;
+  MutexBiMap mutexBiMap;
+  concurrentBiMap.update([&symbols](t_biMap& biMap)
+                         {
+                           for(size_t idx = 0; idx < keyCount; ++idx)
+                           {
+                             symbols.push_back(makeSymbol(idx));
+                             biMap.insert_left(symbols.back(), makeIsin(idx));
+                           }
+                         });
+  for(size_t idx = 0; idx < keyCount; ++idx)
+    mutexBiMap.insert_left(symbols[idx], makeIsin(idx));
+
+  std::cout << std::setw(10) << "threads"
+            << std::setw(22) << "ConcurrentBiMap Mop/s"
+            << std::setw(22) << "mutex+BiMap Mop/s" << std::endl;
+  for(const unsigned threadCount : {1u, 2u, 4u, 8u})
+  {
+    const double concurrentRate = measure(threadCount, symbols,
+                                          [&concurrentBiMap](const std::string& symbol)
+                                          {
+                                            auto snapshot = concurrentBiMap.read();
+                                            auto iter = snapshot->find_left(symbol);
+                                            return !snapshot->isLeft_end(iter);
+                                          });
+    const double mutexRate = measure(threadCount, symbols,
+                                     [&mutexBiMap](const std::string& symbol) { return mutexBiMap.contains(symbol); });
+    std::cout << std::setw(10) << threadCount
+              << std::setw(22) << std::fixed << std::setprecision(2) << concurrentRate
+              << std::setw(22) << mutexRate << std::endl;
+  }
+
+  return 0;
+}
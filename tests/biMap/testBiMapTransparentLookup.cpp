@@ -0,0 +1,111 @@
+// test heterogeneous (std::string_view) lookups and batched find_left_many / find_right_many
+
+#include <span>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <string_view>
+
+#include <biMap/BiMap.h>
+#include <biMap/UnorderedBiMap.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+
+struct TransparentStringHash
+{
+  using is_transparent = void;
+
+  inline size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+};
+
+template <typename BIMAP>
+void checkOrderedOrHashed11(BIMAP& symbolIsin)
+{
+  symbolIsin.insert_left("ABC", "INE000A01011");
+  symbolIsin.insert_left("DEF", "INE111B01012");
+  symbolIsin.insert_left("XYZ", "INE999Z01019");
+
+  // string_view probe, no std::string built
+  const std::string tradeLine = "DEF,INE111B01012,100";
+  const std::string_view symbol = std::string_view(tradeLine).substr(0, 3);
+  const std::string_view isin   = std::string_view(tradeLine).substr(4, 12);
+  auto lefttIter = symbolIsin.find_left(symbol);
+  unittest::ExpectTrue(!symbolIsin.isLeft_end(lefttIter));
+  unittest::ExpectEqual(std::string, "INE111B01012", lefttIter->second);
+  auto rightIter = symbolIsin.find_right(isin);
+  unittest::ExpectTrue(!symbolIsin.isRight_end(rightIter));
+  unittest::ExpectEqual(std::string, "DEF", rightIter->second);
+  lefttIter = symbolIsin.find_left(std::string_view("DE"));
+  unittest::ExpectTrue(symbolIsin.isLeft_end(lefttIter));
+
+  // batched, results in probe order
+  const std::vector<std::string_view> symbols{"XYZ", "ABC", "NONE", "XYZ", "DEF", "AAA", "ZZZ"};
+  auto found = symbolIsin.find_left_many(std::span<const std::string_view>(symbols));
+  unittest::ExpectTrue(found.size() == symbols.size());
+  unittest::ExpectEqual(std::string, "INE999Z01019", found[0]->second);
+  unittest::ExpectEqual(std::string, "INE000A01011", found[1]->second);
+  unittest::ExpectTrue(symbolIsin.isLeft_end(found[2]));
+  unittest::ExpectEqual(std::string, "INE999Z01019", found[3]->second);
+  unittest::ExpectEqual(std::string, "INE111B01012", found[4]->second);
+  unittest::ExpectTrue(symbolIsin.isLeft_end(found[5]));
+  unittest::ExpectTrue(symbolIsin.isLeft_end(found[6]));
+
+  const std::vector<std::string> isins{"INE111B01012", "INE000A01011", "INE555C01010"};
+  auto foundRight = symbolIsin.find_right_many(isins);
+  unittest::ExpectEqual(std::string, "DEF", foundRight[0]->second);
+  unittest::ExpectEqual(std::string, "ABC", foundRight[1]->second);
+  unittest::ExpectTrue(symbolIsin.isRight_end(foundRight[2]));
+}
+
+int main()
+{
+  int rv = 0;
+  try {
+
+    dsbm::BiMap_LR11_RL11<std::string, std::string, std::less<>, std::less<>> orderedSymbolIsin;
+    checkOrderedOrHashed11(orderedSymbolIsin);
+
+    dsbm::UnorderedBiMap_LR11_RL11<std::string, std::string,
+                                   TransparentStringHash, TransparentStringHash,
+                                   std::equal_to<>, std::equal_to<>> hashedSymbolIsin;
+    checkOrderedOrHashed11(hashedSymbolIsin);
+
+//////     batched find, many probes against many keys (crosses the sorted walk's forward-step limit and hash groups)
+
+    dsbm::BiMap_LR1M_RL11<int, int> indxValues;
+    dsbm::UnorderedBiMap_LR1M_RL11<int, int> hashedIndxValues;
+    for(int value = 0; value < 1000; ++value)
+    {
+      indxValues.insert_left(value % 97, value);
+      hashedIndxValues.insert_left(value % 97, value);
+    }
+    std::vector<int> probes;
+    for(int probe = -50; probe < 150; probe += 3)
+      probes.push_back(probe);
+    const auto foundOrdered = indxValues.find_left_many(probes);
+    const auto foundHashed  = hashedIndxValues.find_left_many(probes);
+    const auto foundValues  = indxValues.find_right_many(probes);
+    for(size_t idx = 0; idx < probes.size(); ++idx)
+    {
+      auto orderedIter = indxValues.find_left(probes[idx]);
+      auto hashedIter  = hashedIndxValues.find_left(probes[idx]);
+      auto valueIter   = indxValues.find_right(probes[idx]);
+      unittest::ExpectTrue(foundOrdered[idx] == orderedIter);
+      unittest::ExpectTrue(foundHashed[idx] == hashedIter);
+      unittest::ExpectTrue(foundValues[idx] == valueIter);
+    }
+    unittest::ExpectTrue(indxValues.find_left_many(std::span<const int>()).empty());
+
+    dsbm::UnorderedBiMap_LR11_RL11<int, int> emptyHashed;
+    const auto foundInEmpty = emptyHashed.find_left_many(probes);
+    unittest::ExpectTrue(foundInEmpty.size() == probes.size());
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
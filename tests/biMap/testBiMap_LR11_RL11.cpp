@@ -2,14 +2,39 @@
 // test BiMap with map<Left,Right>::{1,1}  and map<Right,Left>::{1,1}
 
 #include <string>
+#include <vector>
+#include <utility>
 #include <iostream>
 
 #include <biMap/BiMap.h>
 
-#include "../unittest.h"
+#include <unittest.h>
 
 namespace dsbm = datastructure::bimap;
 
+// a key whose copies throw once 'copyBudget' of them are spent ( < 0 : no limit )
+struct FragileKey
+{
+  inline static int copyBudget = -1;
+  std::string name;
+
+  FragileKey(const char* keyName) : name(keyName) {}
+  FragileKey(const FragileKey& other) : name((_spendCopy(), other.name)) {}
+  FragileKey(FragileKey&&) noexcept = default;
+  FragileKey& operator=(const FragileKey& other) { _spendCopy(); name = other.name; return *this; }
+  FragileKey& operator=(FragileKey&&) noexcept = default;
+  auto operator<=>(const FragileKey&) const = default;
+
+private:
+  static void _spendCopy()
+  {
+    if(copyBudget == 0)
+      throw std::runtime_error("FragileKey copy failed");
+    if(copyBudget > 0)
+      --copyBudget;
+  }
+};
+
 
 int main()
 {
@@ -177,6 +202,60 @@ int main()
     searchResultR = indxName.find_right("eeee");
     unittest::ExpectTrue(indxName.isRight_end(searchResultR));
 
+//////     tests for    rekey_left / rekey_right
+
+    unittest::ExpectTrue(indxName.rekey_left(3, 30));
+    unittest::ExpectTrue(indxName.find_left(3) == indxName.getLefttMap().end());
+    unittest::ExpectEqual(std::string, "CCCC", indxName.find_left(30)->second);
+    unittest::ExpectEqual(int, 30, indxName.find_right("CCCC")->second);
+    unittest::ExpectTrue(!indxName.rekey_left(3, 31));     // old key absent
+    unittest::ExpectTrue(!indxName.rekey_left(30, 1));     // new key exists
+
+    unittest::ExpectTrue(indxName.rekey_right("CCCC", "cccc"));
+    unittest::ExpectEqual(std::string, "cccc", indxName.find_left(30)->second);
+    unittest::ExpectEqual(int, 30, indxName.find_right("cccc")->second);
+    unittest::ExpectTrue(indxName.find_right("CCCC") == indxName.getRightMap().end());
+    unittest::ExpectTrue(!indxName.rekey_right("CCCC", "xxxx"));
+    unittest::ExpectTrue(!indxName.rekey_right("cccc", "AAAA"));
+    unittest::ExpectTrue(indxName.size_left() == 5);
+    unittest::ExpectTrue(indxName.size_right() == 5);
+
+    //////////       a key copy throwing mid-rekey leaves both maps as they were
+
+    dsbm::BiMap_LR11_RL11<int, FragileKey> indxFragile;
+    indxFragile.insert_left(1, FragileKey{"AAAA"});
+    FragileKey::copyBudget = 1;
+    ExpectException(indxFragile.rekey_right(FragileKey{"AAAA"} COMMA FragileKey{"aaaa"}), std::runtime_error);
+    FragileKey::copyBudget = -1;
+    unittest::ExpectTrue(indxFragile.size_left() == 1 && indxFragile.size_right() == 1);
+    unittest::ExpectEqual(std::string, "AAAA", indxFragile.find_left(1)->second.name);
+    unittest::ExpectEqual(int, 1, indxFragile.find_right(FragileKey{"AAAA"})->second);
+
+//////     tests for    erase_left / erase_right
+
+    unittest::ExpectTrue(indxName.erase_left(30));
+    unittest::ExpectTrue(!indxName.erase_left(30));
+    unittest::ExpectTrue(indxName.find_right("cccc") == indxName.getRightMap().end());
+    unittest::ExpectTrue(indxName.erase_right("EEEE"));
+    unittest::ExpectTrue(!indxName.erase_right("EEEE"));
+    unittest::ExpectTrue(indxName.find_left(5) == indxName.getLefttMap().end());
+    unittest::ExpectTrue(indxName.size_left() == 3);
+    unittest::ExpectTrue(indxName.size_right() == 3);
+
+//////     tests for    insert_sorted
+
+    const std::vector<std::pair<int, std::string>> sortedPairs{
+      {0, "0000"}, {1, "XXXX"} /* left exists */, {3, "3333"}, {6, "AAAA"} /* right exists */, {7, "7777"}, {7, "7778"} };
+    unittest::ExpectTrue(indxName.insert_sorted(sortedPairs) == 3);
+    unittest::ExpectTrue(indxName.size_left() == 6);
+    unittest::ExpectTrue(indxName.size_right() == 6);
+    unittest::ExpectEqual(std::string, "AAAA", indxName.find_left(1)->second);
+    unittest::ExpectEqual(int, 1, indxName.find_right("AAAA")->second);
+    unittest::ExpectEqual(int, 3, indxName.find_right("3333")->second);
+    unittest::ExpectEqual(std::string, "7777", indxName.find_left(7)->second);
+    unittest::ExpectTrue(indxName.find_right("XXXX") == indxName.getRightMap().end());
+    unittest::ExpectTrue(indxName.find_right("7778") == indxName.getRightMap().end());
+
   } catch (const std::exception& ex) {
     std::cout << ex.what() << std::endl;
     rv = 1;
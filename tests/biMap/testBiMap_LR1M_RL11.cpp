@@ -2,11 +2,13 @@
 // test BiMap with map<Left,Right>::{1,1}  and map<Right,Left>::{1,1}
 
 #include <string>
+#include <vector>
+#include <utility>
 #include <iostream>
 
 #include <biMap/BiMap.h>
 
-#include "../unittest.h"
+#include <unittest.h>
 
 namespace dsbm = datastructure::bimap;
 
@@ -183,6 +185,64 @@ int main()
     searchResultR = indxNames.find_right("eeee1");
     unittest::ExpectTrue(indxNames.isRight_end(searchResultR));
 
+
+//////     tests for    contains_left / contains_right
+
+    unittest::ExpectTrue(indxNames.contains_left(1, "AAAA2"));
+    unittest::ExpectTrue(!indxNames.contains_left(1, "CCCC1"));
+    unittest::ExpectTrue(!indxNames.contains_left(0, "AAAA1"));
+    unittest::ExpectTrue(indxNames.contains_right("EEEE2", 5));
+    unittest::ExpectTrue(!indxNames.contains_right("EEEE2", 4));
+    unittest::ExpectTrue(!indxNames.contains_right("eeee2", 5));
+
+
+//////     tests for    rekey_left / rekey_right
+
+    const size_t sizeLeft = indxNames.size_left();
+    const size_t sizeRight = indxNames.size_right();
+    unittest::ExpectTrue(indxNames.rekey_left(5, 50));
+    unittest::ExpectTrue(indxNames.contains_left(50, "EEEE1"));
+    unittest::ExpectTrue(indxNames.contains_right("EEEE2", 50));
+    unittest::ExpectTrue(!indxNames.rekey_left(5, 51));
+    unittest::ExpectTrue(!indxNames.rekey_left(50, 1));
+
+    unittest::ExpectTrue(indxNames.rekey_right("EEEE2", "eeee2"));
+    unittest::ExpectTrue(indxNames.contains_left(50, "eeee2"));
+    unittest::ExpectTrue(!indxNames.contains_left(50, "EEEE2"));
+    unittest::ExpectTrue(indxNames.contains_right("eeee2", 50));
+    unittest::ExpectTrue(!indxNames.rekey_right("EEEE2", "xxxx"));
+    unittest::ExpectTrue(!indxNames.rekey_right("eeee2", "AAAA1"));
+    unittest::ExpectTrue(indxNames.size_left() == sizeLeft);
+    unittest::ExpectTrue(indxNames.size_right() == sizeRight);
+
+//////     tests for    erase_left / erase_right
+
+    unittest::ExpectTrue(indxNames.erase_left(50) == 2);
+    unittest::ExpectTrue(indxNames.erase_left(50) == 0);
+    unittest::ExpectTrue(indxNames.isRight_end(searchResultR = indxNames.find_right("EEEE1")));
+    unittest::ExpectTrue(indxNames.size_left() == sizeLeft - 1);
+    unittest::ExpectTrue(indxNames.size_right() == sizeRight - 2);
+
+    unittest::ExpectTrue(indxNames.erase_right("AAAA2"));
+    unittest::ExpectTrue(!indxNames.erase_right("AAAA2"));
+    unittest::ExpectTrue(!indxNames.contains_left(1, "AAAA2"));
+    unittest::ExpectTrue(indxNames.size_left() == sizeLeft - 1);          // 1 still has AAAA1
+    unittest::ExpectTrue(indxNames.erase_right("AAAA1"));
+    unittest::ExpectTrue(indxNames.size_left() == sizeLeft - 2);          // last right-key of 1 erased
+    unittest::ExpectTrue(indxNames.size_right() == sizeRight - 4);
+
+//////     tests for    insert_sorted
+
+    const std::vector<std::pair<int, std::string>> sortedPairs{
+      {0, "0000a"}, {0, "0000b"}, {3, "3333a"}, {3, "CCCC1"} /* right exists */, {8, "8888a"} };
+    unittest::ExpectTrue(indxNames.insert_sorted(sortedPairs) == 4);
+    unittest::ExpectTrue(indxNames.find_left(0)->second.size() == 2);
+    unittest::ExpectTrue(indxNames.contains_left(3, "3333a"));
+    unittest::ExpectTrue(indxNames.contains_left(3, "CCCC1"));
+    unittest::ExpectTrue(indxNames.contains_right("8888a", 8));
+    unittest::ExpectTrue(indxNames.size_left() == sizeLeft);
+    unittest::ExpectTrue(indxNames.size_right() == sizeRight);
+
   } catch (const std::exception& ex) {
     std::cout << ex.what() << std::endl;
     rv = 1;
@@ -0,0 +1,115 @@
+// test BiMap_LRMM_RLMM : many-to-many index <-> constituent, CSR packed in both directions
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <biMap/ManyToManyBiMap.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+
+using t_indexConstituents = dsbm::BiMap_LRMM_RLMM<std::string, std::string>;
+
+int main()
+{
+  int rv = 0;
+  try {
+
+//////     build from pairs in any order, with duplicates
+
+    t_indexConstituents::Builder builder;
+    builder.insert("NIFTY50", "RELIANCE");
+    builder.insert("NIFTYBANK", "HDFCBANK");
+    builder.insert("NIFTY50", "HDFCBANK");
+    builder.insert("NIFTYIT", "INFY");
+    builder.insert("NIFTY50", "INFY");
+    builder.insert("NIFTYBANK", "ICICIBANK");
+    builder.insert("NIFTY50", "RELIANCE");      // duplicate
+    builder.insert("NIFTY50", "ICICIBANK");
+    const t_indexConstituents indexConstituents = std::move(builder).build();
+
+    unittest::ExpectTrue(indexConstituents.size_left() == 3);
+    unittest::ExpectTrue(indexConstituents.size_right() == 4);
+    unittest::ExpectTrue(indexConstituents.size_pairs() == 7);
+
+    const auto nifty50 = indexConstituents.find_left("NIFTY50");
+    unittest::ExpectTrue(std::vector<std::string>(nifty50.begin(), nifty50.end()) ==
+                         std::vector<std::string>({"HDFCBANK", "ICICIBANK", "INFY", "RELIANCE"}));
+    unittest::ExpectEqual(std::string, "INFY", nifty50[2]);
+    const auto hdfcBank = indexConstituents.find_right("HDFCBANK");
+    unittest::ExpectTrue(std::vector<std::string>(hdfcBank.begin(), hdfcBank.end()) ==
+                         std::vector<std::string>({"NIFTY50", "NIFTYBANK"}));
+    const auto reliance = indexConstituents.find_right("RELIANCE");
+    unittest::ExpectTrue(reliance.size() == 1);
+    unittest::ExpectEqual(std::string, "NIFTY50", *reliance.begin());
+
+    // neighbour indices are contiguous and ascending
+    const auto niftyBankIdx = indexConstituents.find_left("NIFTYBANK").indices();
+    unittest::ExpectTrue(niftyBankIdx.size() == 2 && niftyBankIdx[0] < niftyBankIdx[1]);
+    unittest::ExpectEqual(std::string, "ICICIBANK", indexConstituents.rightKeys()[niftyBankIdx[1]]);
+
+    // positional access, as used by full scans
+    unittest::ExpectEqual(std::string, "NIFTYBANK", indexConstituents.lefttKeys()[1]);
+    unittest::ExpectTrue(indexConstituents.neighbours_left(1).size() == 2);
+    unittest::ExpectEqual(std::string, "NIFTY50", indexConstituents.neighbours_right(0)[0]);
+
+    unittest::ExpectTrue(indexConstituents.find_left("SENSEX").empty());
+    unittest::ExpectTrue(indexConstituents.find_right("TCS").empty());
+    unittest::ExpectTrue(indexConstituents.contains("NIFTYIT", "INFY"));
+    unittest::ExpectTrue(!indexConstituents.contains("NIFTYIT", "HDFCBANK"));
+    unittest::ExpectTrue(!indexConstituents.contains("SENSEX", "INFY"));
+
+//////     edit through a builder and rebuild
+
+    t_indexConstituents::Builder rebalance = indexConstituents.toBuilder();
+    rebalance.erase("NIFTY50", "ICICIBANK");
+    rebalance.erase("NIFTYIT", "INFY");         // NIFTYIT left with no constituent
+    rebalance.erase("NIFTYIT", "WIPRO");        // not present
+    rebalance.insert("NIFTYIT", "TCS");
+    rebalance.insert("NIFTY50", "TCS");
+    const t_indexConstituents rebalanced = std::move(rebalance).build();
+
+    unittest::ExpectTrue(rebalanced.size_left() == 3);
+    unittest::ExpectTrue(rebalanced.size_right() == 5);
+    unittest::ExpectTrue(rebalanced.size_pairs() == 7);
+    unittest::ExpectTrue(!rebalanced.contains("NIFTY50", "ICICIBANK"));
+    unittest::ExpectTrue(rebalanced.contains("NIFTYBANK", "ICICIBANK"));
+    const auto tcs = rebalanced.find_right("TCS");
+    unittest::ExpectTrue(std::vector<std::string>(tcs.begin(), tcs.end()) ==
+                         std::vector<std::string>({"NIFTY50", "NIFTYIT"}));
+    unittest::ExpectTrue(rebalanced.find_right("INFY").size() == 1);
+    // the original is untouched
+    unittest::ExpectTrue(indexConstituents.contains("NIFTYIT", "INFY"));
+
+//////     insert and erase of the same pair : the last call wins
+
+    t_indexConstituents::Builder reconstitute = rebalanced.toBuilder();
+    reconstitute.erase("NIFTY50", "TCS");
+    reconstitute.insert("NIFTY50", "TCS");      // erased, then re-inserted : kept
+    reconstitute.insert("NIFTYIT", "WIPRO");
+    reconstitute.erase("NIFTYIT", "WIPRO");     // inserted, then erased : dropped
+    reconstitute.erase("NIFTYIT", "TCS");
+    reconstitute.insert("NIFTYIT", "TCS");
+    reconstitute.erase("NIFTYIT", "TCS");       // erased last : dropped
+    const t_indexConstituents reconstituted = std::move(reconstitute).build();
+
+    unittest::ExpectTrue(reconstituted.contains("NIFTY50", "TCS"));
+    unittest::ExpectTrue(!reconstituted.contains("NIFTYIT", "WIPRO"));
+    unittest::ExpectTrue(!reconstituted.contains("NIFTYIT", "TCS"));
+    unittest::ExpectTrue(reconstituted.size_pairs() == rebalanced.size_pairs() - 1);
+
+//////     empty
+
+    const t_indexConstituents empty = t_indexConstituents::Builder().build();
+    unittest::ExpectTrue(empty.size_left() == 0 && empty.size_right() == 0 && empty.size_pairs() == 0);
+    unittest::ExpectTrue(empty.find_left("NIFTY50").empty());
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
@@ -0,0 +1,105 @@
+// test ConcurrentBiMap : lock-free readers over snapshots published by a serialized writer
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+#include <biMap/ConcurrentBiMap.h>
+#include <biMap/UnorderedBiMap.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+
+int main()
+{
+  int rv = 0;
+  try {
+
+//////     single thread : lookups, copy-on-write batches
+
+    dsbm::ConcurrentBiMap<dsbm::BiMap_LR11_RL11<int,std::string>> indxName;
+    unittest::ExpectTrue(indxName.insert_left(1, "AAAA"));
+    unittest::ExpectTrue(indxName.insert_left(2, "BBBB"));
+    unittest::ExpectTrue(!indxName.insert_left(2, "XXXX"));
+    unittest::ExpectTrue(!indxName.insert_left(3, "AAAA"));
+    unittest::ExpectEqual(std::string, "BBBB", indxName.find_left(2).value());
+    unittest::ExpectEqual(int, 1, indxName.find_right("AAAA").value());
+    unittest::ExpectTrue(!indxName.find_left(3).has_value());
+    unittest::ExpectTrue(!indxName.find_right("CCCC").has_value());
+
+    {
+      auto pinned = indxName.read();
+      indxName.update([](dsbm::BiMap_LR11_RL11<int,std::string>& biMap)
+                      {
+                        biMap.insert_left(3, "CCCC");
+                        biMap.insert_left(4, "DDDD");
+                      });
+      // the pinned snapshot is unchanged and not yet reclaimed
+      unittest::ExpectTrue(pinned->size_left() == 2);
+      unittest::ExpectTrue(indxName.read()->size_left() == 4);
+      unittest::ExpectTrue(indxName.reclaim() > 0);
+    }
+    unittest::ExpectTrue(indxName.reclaim() == 0);
+
+    const size_t countInserted = indxName.update([](dsbm::BiMap_LR11_RL11<int,std::string>& biMap) -> size_t
+                                                 {
+                                                   return biMap.insert_left(5, "EEEE").second ? 1 : 0;
+                                                 });
+    unittest::ExpectTrue(countInserted == 1);
+    unittest::ExpectEqual(int, 5, indxName.find_right("EEEE").value());
+
+//////     over a hash-table bimap
+
+    dsbm::ConcurrentBiMap<dsbm::UnorderedBiMap_LR1M_RL11<int,std::string>> indxNames;
+    indxNames.insert_left(1, "AAAA1");
+    indxNames.insert_left(1, "AAAA2");
+    unittest::ExpectTrue(indxNames.find_left(1).value().size() == 2);
+    unittest::ExpectTrue(indxNames.read()->contains_left(1, "AAAA2"));
+
+//////     readers concurrent with a writer : each snapshot is internally consistent
+
+    dsbm::ConcurrentBiMap<dsbm::BiMap_LR11_RL11<int,int>> counterMap;
+    constexpr int writeCount = 500;
+    std::atomic<bool> writerDone{false};
+    std::atomic<size_t> inconsistentReads{0};
+    std::vector<std::thread> readers;
+    for(int thrd = 0; thrd < 4; ++thrd)
+    {
+      readers.emplace_back([&counterMap, &writerDone, &inconsistentReads]()
+                           {
+                             while(!writerDone.load())
+                             {
+                               auto snapshot = counterMap.read();
+                               const size_t sizeLeft = snapshot->size_left();
+                               // keys 0..sizeLeft-1 were inserted, each mapped to its negative
+                               if(sizeLeft != snapshot->size_right())
+                                 ++inconsistentReads;
+                               for(int key = 0; key < static_cast<int>(sizeLeft); key += 7)
+                               {
+                                 auto iter = snapshot->find_left(key);
+                                 if(snapshot->isLeft_end(iter) || iter->second != -key)
+                                   ++inconsistentReads;
+                               }
+                             }
+                           });
+    }
+    for(int key = 0; key < writeCount; ++key)
+      counterMap.insert_left(key, -key);
+    writerDone = true;
+    for(std::thread& reader : readers)
+      reader.join();
+
+    unittest::ExpectTrue(inconsistentReads == 0);
+    unittest::ExpectTrue(counterMap.read()->size_left() == writeCount);
+    unittest::ExpectTrue(counterMap.reclaim() == 0);
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
@@ -0,0 +1,188 @@
+
+// test FrozenBiMap : sorted flat arrays for both directions, owned or as a view over a flat buffer
+
+#include <array>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <biMap/FrozenBiMap.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+
+using t_isin = std::array<char, 12>;
+
+t_isin toIsin(const std::string& isin)
+{
+  t_isin fixed{};
+  isin.copy(fixed.data(), fixed.size());
+  return fixed;
+}
+
+// stateful comparator : a default constructed one takes the order in effect at construction
+bool g_descendingOrder = false;
+struct OrderedLess
+{
+  bool descending = g_descendingOrder;
+  bool operator()(int lhs, int rhs) const { return descending ? (rhs < lhs) : (lhs < rhs); }
+};
+
+int main()
+{
+  int rv = 0;
+  try {
+
+//////     branchlessLowerBound
+
+    const std::vector<int> sorted{1, 3, 3, 5, 9};
+    for(int key = 0; key <= 10; ++key)
+    {
+      const size_t expected = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+      unittest::ExpectEqual(size_t, expected, dsbm::branchlessLowerBound(std::span<const int>(sorted), key, std::less<int>{}));
+    }
+    unittest::ExpectEqual(size_t, size_t(0), dsbm::branchlessLowerBound(std::span<const int>(), 5, std::less<int>{}));
+
+//////     FrozenBiMap_LR11_RL11  from  BiMap_LR11_RL11
+
+    dsbm::BiMap_LR11_RL11<int,std::string> indxName;
+    indxName.insert_left(2, "BBBB");
+    indxName.insert_left(1, "AAAA");
+    indxName.insert_left(5, "EEEE");
+    indxName.insert_left(3, "CCCC");
+
+    const dsbm::FrozenBiMap_LR11_RL11<int,std::string> frozenIndxName = dsbm::FrozenBiMap_LR11_RL11<int,std::string>::freeze(indxName);
+    unittest::ExpectTrue(frozenIndxName.size_left() == 4);
+    unittest::ExpectTrue(frozenIndxName.size_right() == 4);
+    unittest::ExpectTrue(!frozenIndxName.isView());
+    for(const auto& [lefttKey, rightKey] : indxName.getLefttMap())
+    {
+      unittest::ExpectEqual(std::string, rightKey, *frozenIndxName.find_left(lefttKey));
+      unittest::ExpectEqual(int, lefttKey, *frozenIndxName.find_right(rightKey));
+    }
+    unittest::ExpectTrue(frozenIndxName.find_left(0) == nullptr);
+    unittest::ExpectTrue(frozenIndxName.find_left(4) == nullptr);
+    unittest::ExpectTrue(frozenIndxName.find_left(6) == nullptr);
+    unittest::ExpectTrue(frozenIndxName.find_right("aaaa") == nullptr);
+    unittest::ExpectTrue(frozenIndxName.find_right("ZZZZ") == nullptr);
+
+//////     FrozenBiMap_LR11_RL11  from  unsorted pairs
+
+    const dsbm::FrozenBiMap_LR11_RL11<int,std::string> frozenFromPairs{{{5, "EEEE"}, {1, "AAAA"}, {3, "CCCC"}, {2, "BBBB"}}};
+    unittest::ExpectEqual(std::string, "CCCC", *frozenFromPairs.find_left(3));
+    unittest::ExpectEqual(int, 2, *frozenFromPairs.find_right("BBBB"));
+
+    bool duplicateThrown = false;
+    try {
+      dsbm::FrozenBiMap_LR11_RL11<int,std::string> duplicateRight{{{1, "AAAA"}, {2, "AAAA"}}};
+    } catch (const std::invalid_argument&) {
+      duplicateThrown = true;
+    }
+    unittest::ExpectTrue(duplicateThrown);
+
+//////     FrozenBiMap_LR11_RL11  view over a flat buffer
+
+    dsbm::BiMap_LR11_RL11<int,t_isin> indxIsin;
+    for(int idx = 0; idx < 100; ++idx)
+      indxIsin.insert_left(idx * 7, toIsin("INE" + std::to_string(1000 + idx) + "A0102"));
+    std::string flatBuffer;
+    dsbm::FrozenBiMap_LR11_RL11<int,t_isin>::freeze(indxIsin).serialize(flatBuffer);
+
+    std::vector<uint64_t> alignedBuffer((flatBuffer.size() + 7) / 8);   // stands in for a memory-mapped file
+    std::memcpy(alignedBuffer.data(), flatBuffer.data(), flatBuffer.size());
+    const auto isinView = dsbm::FrozenBiMap_LR11_RL11<int,t_isin>::view(alignedBuffer.data(), flatBuffer.size());
+    unittest::ExpectTrue(isinView.isView());
+    unittest::ExpectTrue(isinView.size_left() == 100);
+    unittest::ExpectTrue(*isinView.find_left(7 * 42) == toIsin("INE1042A0102"));
+    unittest::ExpectEqual(int, 7 * 99, *isinView.find_right(toIsin("INE1099A0102")));
+    unittest::ExpectTrue(isinView.find_left(8) == nullptr);
+
+    bool truncatedThrown = false;
+    try {
+      dsbm::FrozenBiMap_LR11_RL11<int,t_isin>::view(alignedBuffer.data(), flatBuffer.size() - 1);
+    } catch (const std::invalid_argument&) {
+      truncatedThrown = true;
+    }
+    unittest::ExpectTrue(truncatedThrown);
+
+    bool magicThrown = false;
+    try {
+      dsbm::FrozenBiMap_LR1M_RL11<int,t_isin>::view(alignedBuffer.data(), flatBuffer.size());
+    } catch (const std::invalid_argument&) {
+      magicThrown = true;
+    }
+    unittest::ExpectTrue(magicThrown);
+
+//////     FrozenBiMap_LR1M_RL11  from  BiMap_LR1M_RL11
+
+    dsbm::BiMap_LR1M_RL11<int,std::string> indxNames;
+    indxNames.insert_left(2, "BBBB1");
+    indxNames.insert_left(1, "AAAA2");
+    indxNames.insert_left(1, "AAAA1");
+    indxNames.insert_left(5, "EEEE1");
+    indxNames.insert_left(5, "EEEE3");
+    indxNames.insert_left(5, "EEEE2");
+
+    const auto frozenIndxNames = dsbm::FrozenBiMap_LR1M_RL11<int,std::string>::freeze(indxNames);
+    unittest::ExpectTrue(frozenIndxNames.size_left() == 3);
+    unittest::ExpectTrue(frozenIndxNames.size_right() == 6);
+    const std::span<const std::string> names5 = frozenIndxNames.find_left(5);
+    unittest::ExpectTrue(std::vector<std::string>({"EEEE1", "EEEE2", "EEEE3"}) == std::vector<std::string>(names5.begin(), names5.end()));
+    unittest::ExpectTrue(frozenIndxNames.find_left(3).empty());
+    unittest::ExpectEqual(int, 1, *frozenIndxNames.find_right("AAAA2"));
+    unittest::ExpectTrue(frozenIndxNames.find_right("CCCC1") == nullptr);
+    unittest::ExpectTrue(frozenIndxNames.contains_left(5, "EEEE2"));
+    unittest::ExpectTrue(!frozenIndxNames.contains_left(2, "EEEE2"));
+    unittest::ExpectTrue(frozenIndxNames.contains_right("BBBB1", 2));
+    unittest::ExpectTrue(!frozenIndxNames.contains_right("BBBB1", 1));
+
+    const dsbm::FrozenBiMap_LR1M_RL11<int,std::string> frozenNamesFromPairs{{{5, "EEEE2"}, {2, "BBBB1"}, {5, "EEEE1"}}};
+    unittest::ExpectTrue(frozenNamesFromPairs.size_left() == 2);
+    unittest::ExpectEqual(std::string, "EEEE1", frozenNamesFromPairs.find_left(5).front());
+
+//////     FrozenBiMap_LR1M_RL11  view over a flat buffer
+
+    dsbm::BiMap_LR1M_RL11<int,t_isin> indxIsins;
+    for(int idx = 0; idx < 100; ++idx)
+      indxIsins.insert_left(idx % 10, toIsin("INE" + std::to_string(1000 + idx) + "A0102"));
+    std::string flatBuffer1M;
+    dsbm::FrozenBiMap_LR1M_RL11<int,t_isin>::freeze(indxIsins).serialize(flatBuffer1M);
+    std::vector<uint64_t> alignedBuffer1M((flatBuffer1M.size() + 7) / 8);
+    std::memcpy(alignedBuffer1M.data(), flatBuffer1M.data(), flatBuffer1M.size());
+    const auto isinsView = dsbm::FrozenBiMap_LR1M_RL11<int,t_isin>::view(alignedBuffer1M.data(), flatBuffer1M.size());
+    unittest::ExpectTrue(isinsView.size_left() == 10);
+    unittest::ExpectTrue(isinsView.size_right() == 100);
+    unittest::ExpectTrue(isinsView.find_left(3).size() == 10);
+    unittest::ExpectTrue(isinsView.contains_left(3, toIsin("INE1093A0102")));
+    unittest::ExpectEqual(int, 7, *isinsView.find_right(toIsin("INE1057A0102")));
+
+//////     freeze() keeps the comparators of the source BiMap
+
+    g_descendingOrder = true;
+    dsbm::BiMap_LR11_RL11<int,int,OrderedLess,OrderedLess> descending11;
+    dsbm::BiMap_LR1M_RL11<int,int,OrderedLess,OrderedLess> descending1M;
+    g_descendingOrder = false;
+    for(int key = 1; key <= 9; ++key)
+    {
+      descending11.insert_left(key, 100 + key);
+      descending1M.insert_left(key % 3, 100 + key);
+    }
+    const auto frozenDescending11 = dsbm::FrozenBiMap_LR11_RL11<int,int,OrderedLess,OrderedLess>::freeze(descending11);
+    const auto frozenDescending1M = dsbm::FrozenBiMap_LR1M_RL11<int,int,OrderedLess,OrderedLess>::freeze(descending1M);
+    for(int key = 1; key <= 9; ++key)
+    {
+      unittest::ExpectEqual(int, 100 + key, *frozenDescending11.find_left(key));
+      unittest::ExpectEqual(int, key, *frozenDescending11.find_right(100 + key));
+      unittest::ExpectEqual(int, key % 3, *frozenDescending1M.find_right(100 + key));
+      unittest::ExpectTrue(frozenDescending1M.contains_left(key % 3, 100 + key));
+    }
+    unittest::ExpectTrue(frozenDescending1M.find_left(1).size() == 3);
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
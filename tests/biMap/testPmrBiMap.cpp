@@ -0,0 +1,132 @@
+// test bimaps over a std::pmr arena, node-handle recycling and memory_usage()
+
+#include <set>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <memory_resource>
+
+#include <biMap/BiMap.h>
+#include <biMap/SmallSortedSet.h>
+#include <biMap/FrozenBiMap.h>
+#include <biMap/ManyToManyBiMap.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+
+int main()
+{
+  int rv = 0;
+  try {
+
+//////     pmr::BiMap_LR11_RL11 : nodes and pmr::string keys come from the arena
+
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::set_default_resource(std::pmr::null_memory_resource());   // any allocation outside the arena throws
+    {
+      dsbm::pmr::BiMap_LR11_RL11<std::pmr::string, std::pmr::string> symbolIsin(&arena);
+      unittest::ExpectTrue(symbolIsin.get_allocator().resource() == &arena);
+      unittest::ExpectTrue(symbolIsin.insert_left("RELIANCE", "INE002A01018").second);
+      // a probe beyond the small-string buffer must not allocate outside the arena either
+      const std::pmr::string longSymbol("A_VERY_LONG_SYMBOL_NAME", &arena);
+      unittest::ExpectTrue(symbolIsin.insert_left(longSymbol, "INE009A01021").second);
+      unittest::ExpectTrue(!symbolIsin.insert_left("RELIANCE", "INE040A01034").second);
+      unittest::ExpectEqual(std::pmr::string, "INE002A01018", symbolIsin.find_left("RELIANCE")->second);
+      unittest::ExpectTrue(symbolIsin.erase_right("INE009A01021"));
+      unittest::ExpectTrue(symbolIsin.size_left() == 1 && symbolIsin.size_right() == 1);
+
+      dsbm::pmr::BiMap_LR1M_RL11<int, int> indxValues(&arena);
+      for(int value = 0; value < 100; ++value)
+        indxValues.insert_left(value % 7, value);
+      unittest::ExpectTrue(indxValues.size_left() == 7 && indxValues.size_right() == 100);
+      unittest::ExpectTrue(indxValues.find_left(3)->second.get_allocator().resource() == &arena);
+      unittest::ExpectTrue(indxValues.erase_left(3) == 14);
+      unittest::ExpectTrue(indxValues.rekey_right(11, 1000));
+      unittest::ExpectTrue(indxValues.contains_left(4, 1000));
+    }
+    std::pmr::set_default_resource(nullptr);
+
+//////     node handles : erase + insert reusing the nodes
+
+    dsbm::BiMap_LR11_RL11<int, std::string> indxName;
+    indxName.insert_left(1, "AAAA");
+    indxName.insert_left(2, "BBBB");
+    indxName.insert_left(3, "CCCC");
+
+    auto node = indxName.extract_left(2);
+    unittest::ExpectTrue(!node.empty());
+    unittest::ExpectTrue(indxName.size_left() == 2 && indxName.size_right() == 2);
+    unittest::ExpectEqual(int, 2, node.lefttKey());
+    unittest::ExpectEqual(std::string, "BBBB", node.rightKey());
+
+    node.rekey(4, "AAAA");
+    unittest::ExpectTrue(!indxName.insert(std::move(node)));       // right-key exists, node kept
+    unittest::ExpectTrue(!node.empty());
+    node.rekey(4, "DDDD");
+    unittest::ExpectTrue(indxName.insert(std::move(node)));
+    unittest::ExpectTrue(node.empty());
+    unittest::ExpectEqual(std::string, "DDDD", indxName.find_left(4)->second);
+    unittest::ExpectEqual(int, 4, indxName.find_right("DDDD")->second);
+
+    auto rightNode = indxName.extract_right("AAAA");
+    unittest::ExpectEqual(int, 1, rightNode.lefttKey());
+    unittest::ExpectTrue(indxName.extract_right("ZZZZ").empty());
+    unittest::ExpectTrue(!indxName.insert(decltype(rightNode){}));
+    unittest::ExpectTrue(indxName.insert(std::move(rightNode)));
+    unittest::ExpectTrue(indxName.size_left() == 3 && indxName.size_right() == 3);
+
+//////     memory_usage
+
+    dsbm::BiMap_LR11_RL11<int, int> emptyBiMap;
+    unittest::ExpectTrue(emptyBiMap.memory_usage() == sizeof(emptyBiMap));
+    dsbm::BiMap_LR11_RL11<int, int> twoPairs;
+    twoPairs.insert_left(1, 10);
+    twoPairs.insert_left(2, 20);
+    const size_t pairBytes = (twoPairs.memory_usage() - sizeof(twoPairs)) / 2;
+    unittest::ExpectTrue(pairBytes >= 2 * (sizeof(std::pair<const int, int>) + 3 * sizeof(void*)));
+
+    // a key beyond the small-string buffer adds its heap buffer
+    dsbm::BiMap_LR11_RL11<std::string, int> shortKey, longKey;
+    shortKey.insert_left("ABC", 1);
+    longKey.insert_left(std::string(100, 'A'), 1);
+    unittest::ExpectTrue(longKey.memory_usage() >= shortKey.memory_usage() + 100);
+
+    dsbm::BiMap_LR1M_RL11<int, int> setRights;
+    dsbm::SmallSetBiMap_LR1M_RL11<int, int, 4> inlineRights;
+    for(int value = 0; value < 12; ++value)
+    {
+      setRights.insert_left(value % 4, value);
+      inlineRights.insert_left(value % 4, value);
+    }
+    unittest::ExpectTrue(inlineRights.memory_usage() < setRights.memory_usage());
+
+    dsbm::SmallSortedSet<int, 2> smallSet;
+    smallSet.emplace(1);
+    unittest::ExpectTrue(smallSet.memory_usage() == sizeof(smallSet));
+    smallSet.emplace(2);
+    smallSet.emplace(3);
+    unittest::ExpectTrue(smallSet.memory_usage() == sizeof(smallSet) + smallSet.capacity() * sizeof(int));
+
+    dsbm::BiMap_LRMM_RLMM<int, int>::Builder builder;
+    builder.insert(1, 10);
+    builder.insert(1, 20);
+    builder.insert(2, 10);
+    const auto manyToMany = std::move(builder).build();
+    unittest::ExpectTrue(manyToMany.memory_usage() >= sizeof(manyToMany) + 4 * sizeof(int) + 10 * sizeof(uint32_t));
+
+    // freeze accepts a bimap with any allocator
+    std::pmr::monotonic_buffer_resource freezeArena;
+    dsbm::pmr::BiMap_LR11_RL11<int, int> arenaBiMap(&freezeArena);
+    arenaBiMap.insert_left(1, 10);
+    const auto frozen = dsbm::FrozenBiMap_LR11_RL11<int, int>::freeze(arenaBiMap);
+    unittest::ExpectTrue(frozen.size_left() == 1);
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
@@ -0,0 +1,108 @@
+// test SmallSortedSet, and BiMap_LR1M_RL11 with the right-keys held in it
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <iostream>
+
+#include <biMap/SmallSortedSet.h>
+#include <biMap/FrozenBiMap.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+
+int main()
+{
+  int rv = 0;
+  try {
+
+//////     SmallSortedSet : inline up to N, sorted and unique, spills past N
+
+    dsbm::SmallSortedSet<std::string, 2> names;
+    unittest::ExpectTrue(names.empty());
+    unittest::ExpectTrue(names.emplace("CCCC").second);
+    unittest::ExpectTrue(names.emplace("AAAA").second);
+    unittest::ExpectTrue(!names.emplace("CCCC").second);
+    unittest::ExpectTrue(names.isInline());
+    unittest::ExpectTrue(names.emplace("BBBB").second);     // spills
+    unittest::ExpectTrue(!names.isInline());
+    unittest::ExpectTrue(names.emplace("DDDD").second);
+    unittest::ExpectTrue(names.size() == 4);
+    unittest::ExpectTrue(std::vector<std::string>(names.begin(), names.end()) ==
+                         std::vector<std::string>({"AAAA", "BBBB", "CCCC", "DDDD"}));
+    unittest::ExpectTrue(names.contains("BBBB"));
+    unittest::ExpectTrue(!names.contains("bbbb"));
+
+    const dsbm::SmallSortedSet<std::string, 2> namesCopy(names);
+    unittest::ExpectTrue(namesCopy == names);
+    unittest::ExpectTrue(names.erase("BBBB") == 1);
+    unittest::ExpectTrue(names.erase("BBBB") == 0);
+    unittest::ExpectTrue(std::vector<std::string>(names.begin(), names.end()) ==
+                         std::vector<std::string>({"AAAA", "CCCC", "DDDD"}));
+    unittest::ExpectTrue(namesCopy.size() == 4);
+
+    dsbm::SmallSortedSet<std::string, 2> namesMoved(std::move(names));
+    unittest::ExpectTrue(namesMoved.size() == 3);
+    unittest::ExpectTrue(names.empty() && names.isInline());
+    names.emplace("ZZZZ");
+    names = namesMoved;
+    unittest::ExpectTrue(names == namesMoved);
+
+    dsbm::SmallSortedSet<std::string, 2> inlineNames;
+    inlineNames.emplace("BBBB");
+    inlineNames.emplace("AAAA");
+    dsbm::SmallSortedSet<std::string, 2> inlineMoved(std::move(inlineNames));
+    unittest::ExpectTrue(inlineMoved.isInline() && inlineMoved.size() == 2);
+    unittest::ExpectEqual(std::string, "AAAA", *inlineMoved.begin());
+    inlineMoved.clear();
+    unittest::ExpectTrue(inlineMoved.empty());
+
+//////     SmallSetBiMap_LR1M_RL11 : same contract as BiMap_LR1M_RL11
+
+    dsbm::SmallSetBiMap_LR1M_RL11<int, std::string, 2> indxNames;
+    unittest::ExpectTrue(indxNames.insert_left(1, "AAAA2").second);
+    unittest::ExpectTrue(indxNames.insert_left(1, "AAAA1").second);
+    unittest::ExpectTrue(indxNames.insert_left(1, "AAAA3").second);   // spills past 2
+    unittest::ExpectTrue(indxNames.insert_left(2, "BBBB1").second);
+    unittest::ExpectTrue(!indxNames.insert_left(2, "AAAA1").second);
+    unittest::ExpectTrue(!indxNames.insert_left(1, "AAAA1").second);
+    unittest::ExpectTrue(indxNames.size_left() == 2);
+    unittest::ExpectTrue(indxNames.size_right() == 4);
+
+    auto lefttIter = indxNames.find_left(1);
+    unittest::ExpectTrue(!indxNames.isLeft_end(lefttIter));
+    unittest::ExpectTrue(std::vector<std::string>(lefttIter->second.begin(), lefttIter->second.end()) ==
+                         std::vector<std::string>({"AAAA1", "AAAA2", "AAAA3"}));
+    unittest::ExpectTrue(indxNames.contains_left(1, "AAAA3"));
+    unittest::ExpectTrue(!indxNames.contains_left(2, "AAAA3"));
+    unittest::ExpectTrue(indxNames.contains_right("BBBB1", 2));
+    unittest::ExpectEqual(int, 1, indxNames.find_right("AAAA2")->second);
+
+    unittest::ExpectTrue(indxNames.rekey_right("AAAA2", "AAAA0"));
+    unittest::ExpectTrue(indxNames.contains_left(1, "AAAA0"));
+    unittest::ExpectTrue(!indxNames.contains_left(1, "AAAA2"));
+    unittest::ExpectEqual(std::string, "AAAA0", *indxNames.find_left(1)->second.begin());
+    unittest::ExpectTrue(indxNames.rekey_left(2, 20));
+    unittest::ExpectTrue(indxNames.contains_right("BBBB1", 20));
+
+    unittest::ExpectTrue(indxNames.erase_right("AAAA3"));
+    unittest::ExpectTrue(indxNames.erase_left(20) == 1);
+    unittest::ExpectTrue(indxNames.size_left() == 1);
+    unittest::ExpectTrue(indxNames.size_right() == 2);
+
+    const std::vector<std::pair<int, std::string>> sortedPairs{ {3, "CCCC1"}, {3, "CCCC2"}, {4, "DDDD1"} };
+    unittest::ExpectTrue(indxNames.insert_sorted(sortedPairs) == 3);
+
+    const auto frozenIndxNames = dsbm::FrozenBiMap_LR1M_RL11<int, std::string>::freeze(indxNames);
+    unittest::ExpectTrue(frozenIndxNames.size_left() == 3);
+    unittest::ExpectTrue(frozenIndxNames.size_right() == 5);
+    unittest::ExpectTrue(frozenIndxNames.contains_left(3, "CCCC2"));
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
@@ -0,0 +1,127 @@
+// test TimeVersionedBiMap : symbol <-> ISIN as-of a date, with symbol renames and reuse
+
+#include <map>
+#include <chrono>
+#include <string>
+#include <iostream>
+
+#include <biMap/TimeVersionedBiMap.h>
+#include <versionedObject/VersionedObject.h>
+
+#include <unittest.h>
+
+namespace dsbm = datastructure::bimap;
+namespace dsvo = datastructure::versionedObject;
+
+using t_date = std::chrono::year_month_day;
+using t_symbolIsin = dsbm::TimeVersionedBiMap<std::string, std::string, t_date>;
+
+constexpr t_date ymd(int year, unsigned month, unsigned day)
+{
+  return t_date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+}
+
+int main()
+{
+  int rv = 0;
+  try {
+
+//////     insert and as-of lookups
+
+    t_symbolIsin symbolIsin;
+    symbolIsin.insert("ABC", "INE000A01011", ymd(2010,1,1), ymd(2015,6,1));
+    symbolIsin.insert("ABCNEW", "INE000A01011", ymd(2015,6,1));          // renamed, still listed
+    symbolIsin.insert("ABC", "INE999Z01019", ymd(2019,3,1));             // symbol reused by another company
+
+    unittest::ExpectTrue(symbolIsin.find_left("ABC", ymd(2009,12,31)) == nullptr);
+    unittest::ExpectEqual(std::string, "INE000A01011", *symbolIsin.find_left("ABC", ymd(2010,1,1)));
+    unittest::ExpectEqual(std::string, "INE000A01011", *symbolIsin.find_left("ABC", ymd(2015,5,31)));
+    unittest::ExpectTrue(symbolIsin.find_left("ABC", ymd(2015,6,1)) == nullptr);
+    unittest::ExpectTrue(symbolIsin.find_left("ABC", ymd(2019,2,28)) == nullptr);
+    unittest::ExpectEqual(std::string, "INE999Z01019", *symbolIsin.find_left("ABC", ymd(2023,1,1)));
+    unittest::ExpectEqual(std::string, "INE000A01011", *symbolIsin.find_left("ABCNEW", ymd(2023,1,1)));
+
+    unittest::ExpectEqual(std::string, "ABC", *symbolIsin.find_right("INE000A01011", ymd(2012,1,1)));
+    unittest::ExpectEqual(std::string, "ABCNEW", *symbolIsin.find_right("INE000A01011", ymd(2016,1,1)));
+    unittest::ExpectTrue(symbolIsin.find_right("INE999Z01019", ymd(2016,1,1)) == nullptr);
+    unittest::ExpectTrue(symbolIsin.find_right("INE123X01010", ymd(2016,1,1)) == nullptr);
+
+    unittest::ExpectTrue(symbolIsin.size_left() == 2);
+    unittest::ExpectTrue(symbolIsin.size_right() == 2);
+    unittest::ExpectTrue(symbolIsin.timeline_left("ABC").size() == 2);
+    unittest::ExpectTrue(symbolIsin.timeline_right("INE000A01011").size() == 2);
+
+//////     one-to-one per date
+
+    unittest::ExpectTrue(symbolIsin.size_intervals() == 3);
+    bool thrown = false;
+    try {
+      symbolIsin.insert("ABC", "INE555B01012", ymd(2014,1,1), ymd(2016,1,1));   // 'ABC' is INE000A01011 then
+    } catch (const std::invalid_argument&) {
+      thrown = true;
+    }
+    unittest::ExpectTrue(thrown);
+    thrown = false;
+    try {
+      symbolIsin.insert("XYZ", "INE000A01011", ymd(2020,1,1));                  // INE000A01011 is ABCNEW then
+    } catch (const std::invalid_argument&) {
+      thrown = true;
+    }
+    unittest::ExpectTrue(thrown);
+    thrown = false;
+    try {
+      symbolIsin.insert("XYZ", "INE555B01012", ymd(2020,1,1), ymd(2020,1,1));
+    } catch (const std::invalid_argument&) {
+      thrown = true;
+    }
+    unittest::ExpectTrue(thrown);
+    unittest::ExpectTrue(symbolIsin.size_intervals() == 3);
+
+//////     same pair over adjacent / overlapping ranges is coalesced
+
+    t_symbolIsin coalesced;
+    coalesced.insert("DEF", "INE111C01011", ymd(2001,1,1), ymd(2002,1,1));
+    coalesced.insert("DEF", "INE111C01011", ymd(2003,1,1), ymd(2004,1,1));
+    unittest::ExpectTrue(coalesced.size_intervals() == 2);
+    unittest::ExpectTrue(coalesced.find_left("DEF", ymd(2002,6,1)) == nullptr);
+    coalesced.insert("DEF", "INE111C01011", ymd(2002,1,1), ymd(2003,1,1));
+    unittest::ExpectTrue(coalesced.size_intervals() == 1);
+    coalesced.insert("DEF", "INE111C01011", ymd(2003,6,1));
+    unittest::ExpectTrue(coalesced.size_intervals() == 1);
+    unittest::ExpectTrue(coalesced.timeline_left("DEF")[0].fromDate == ymd(2001,1,1));
+    unittest::ExpectTrue(!coalesced.timeline_left("DEF")[0].untilDate.has_value());
+    unittest::ExpectEqual(std::string, "DEF", *coalesced.find_right("INE111C01011", ymd(2030,1,1)));
+
+//////     bulk load from VersionedObject timelines : ISIN -> (symbol, listed)
+
+    using t_versionObject = dsvo::VersionedObject<t_date, std::string, bool>;
+    using t_dataset = t_versionObject::t_dataset;
+    std::map<std::string, t_versionObject> universe;
+    universe["INE000A01011"].insertVersion(ymd(2010,1,1), t_dataset(std::string("ABC"), true));
+    universe["INE000A01011"].insertVersion(ymd(2012,1,1), t_dataset(std::string("ABC"), true));   // other field change
+    universe["INE000A01011"].insertVersion(ymd(2015,6,1), t_dataset(std::string("ABCNEW"), true));
+    universe["INE000A01011"].insertVersion(ymd(2018,9,1), t_dataset(std::string("ABCNEW"), false));
+    universe["INE999Z01019"].insertVersion(ymd(2019,3,1), t_dataset(std::string("ABC"), true));
+
+    t_symbolIsin loaded;
+    loaded.insertTimelines(universe,
+                           [](const std::string& isin, const t_dataset& dataset) -> std::optional<std::pair<std::string, std::string>>
+                           {
+                             if(!std::get<1>(dataset.getRecord()))
+                               return std::nullopt;
+                             return std::pair<std::string, std::string>{std::get<0>(dataset.getRecord()), isin};
+                           });
+    unittest::ExpectTrue(loaded.size_intervals() == 3);
+    unittest::ExpectEqual(std::string, "INE000A01011", *loaded.find_left("ABC", ymd(2013,1,1)));
+    unittest::ExpectEqual(std::string, "INE000A01011", *loaded.find_left("ABCNEW", ymd(2018,8,31)));
+    unittest::ExpectTrue(loaded.find_left("ABCNEW", ymd(2018,9,1)) == nullptr);
+    unittest::ExpectTrue(loaded.find_right("INE000A01011", ymd(2019,1,1)) == nullptr);
+    unittest::ExpectEqual(std::string, "INE999Z01019", *loaded.find_left("ABC", ymd(2019,3,1)));
+
+  } catch (const std::exception& ex) {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
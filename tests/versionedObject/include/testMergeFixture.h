@@ -0,0 +1,42 @@
+#pragma once
+
+// fixture shared by the merge, retention and change-feed tests :
+// versions of the INE435A01028 listing record that differ in symbol and/or market-lot
+
+
+#include <string>
+
+#include <testHelper.h>
+
+
+// version dates on a fixed day of the year, eg: 'const YearlyVersionDate versionDate{std::chrono::June, 30};'
+struct YearlyVersionDate
+{
+  std::chrono::month month;
+  unsigned           day;
+
+  t_versionDate operator()(int year) const { return (*this)(year, day); }
+  t_versionDate operator()(int year, unsigned onDay) const
+  {
+    return t_versionDate{std::chrono::year(year), month, std::chrono::day(onDay)};
+  }
+};
+
+inline t_companyInfo companyInfo(const std::string& symbol = "APPAPER", t_marketLot marketLot = 1)
+{
+  t_companyInfo info = t_convertFromString::ToVal("APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED");
+  std::get<0>(info) = symbol;
+  std::get<4>(info) = marketLot;
+  return info;
+}
+
+// a distinct symbol per year : "SYM2004", "SYM2005", ...
+inline t_companyInfo companyInfo(int year)
+{
+  return companyInfo("SYM" + std::to_string(year));
+}
+
+#if TEST_ENABLE_METADATA == 1
+  inline const dsvo::MetaDataSource exchangeMeta("exchange", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  inline const dsvo::MetaDataSource vendorMeta("vendor", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+#endif
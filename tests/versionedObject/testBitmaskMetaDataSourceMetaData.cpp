@@ -0,0 +1,105 @@
+#include <testHelper.h>
+
+#include <versionedObject/BitmaskMetaDataSource.h>
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+using t_bitmaskVersionObject      = dsvo::VersionedObject<t_versionDate, dsvo::BitmaskMetaDataSource, COMPANYINFO_TYPE_LIST>;
+using t_bitmaskDataSet            = dsvo::DataSet<dsvo::BitmaskMetaDataSource, COMPANYINFO_TYPE_LIST>;
+using t_bitmaskPriorityMerge      = dsvo::VersionedObjectPriorityMerge<t_versionDate, dsvo::BitmaskMetaDataSource, COMPANYINFO_TYPE_LIST>;
+using t_bitmaskVersionObjectStream = dsvo::VersionedObjectStream<t_versionDate, dsvo::BitmaskMetaDataSource, COMPANYINFO_TYPE_LIST>;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const dsvo::StreamerHelper sh{};
+
+  // mergeVersion() : same toCSV() as MetaDataSource
+  dsvo::MetaDataSource vendorA("vendorA", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  dsvo::MetaDataSource vendorB("vendorB", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  dsvo::MetaDataSource vendorC("vendorC", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  dsvo::BitmaskMetaDataSource bitmaskVendorA("vendorA", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  const dsvo::BitmaskMetaDataSource bitmaskVendorB("vendorB", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  const dsvo::BitmaskMetaDataSource bitmaskVendorC("vendorC", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+
+  // merged in an order other than the key order
+  vendorA.mergeVersion(vendorC);
+  vendorA.mergeVersion(vendorB);
+  bitmaskVendorA.mergeVersion(bitmaskVendorC);
+  bitmaskVendorA.mergeVersion(bitmaskVendorB);
+  unittest::ExpectEqual(std::string, "*|*vendorA|*vendorB|*vendorC", bitmaskVendorA.toCSV(sh));
+  unittest::ExpectEqual(std::string, vendorA.toCSV(sh), bitmaskVendorA.toCSV(sh));
+  unittest::ExpectEqual(size_t, size_t(2), bitmaskVendorA.getMergedDataTypes().size());
+  unittest::ExpectEqual(dsvo::MetaDataSource, vendorA, bitmaskVendorA.toMetaDataSource());
+  unittest::ExpectEqual(bool, true, bitmaskVendorA == dsvo::BitmaskMetaDataSource{vendorA});
+
+  // a data-type merged back into itself is dropped, as with MetaDataSource
+  dsvo::MetaDataSource vendorBC{vendorB};
+  vendorBC.mergeVersion(vendorA);
+  dsvo::BitmaskMetaDataSource bitmaskVendorBC{bitmaskVendorB};
+  bitmaskVendorBC.mergeVersion(bitmaskVendorA);
+  unittest::ExpectEqual(std::string, vendorBC.toCSV(sh), bitmaskVendorBC.toCSV(sh));
+
+  // mergeChanges() of delta and snapshot changes
+  dsvo::MetaDataSource symbolChange("symbolChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE);
+  const dsvo::MetaDataSource nameSpot("nameSpot", t_eDataBuild::FORWARD, t_eDataPatch::SNAPSHOT);
+  const dsvo::MetaDataSource lotChange("lotChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE);
+  dsvo::BitmaskMetaDataSource bitmaskSymbolChange("symbolChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE);
+  const dsvo::BitmaskMetaDataSource bitmaskNameSpot("nameSpot", t_eDataBuild::FORWARD, t_eDataPatch::SNAPSHOT);
+  const dsvo::BitmaskMetaDataSource bitmaskLotChange("lotChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE);
+  symbolChange.mergeChanges(nameSpot);
+  symbolChange.mergeChanges(lotChange);
+  bitmaskSymbolChange.mergeChanges(bitmaskNameSpot);
+  bitmaskSymbolChange.mergeChanges(bitmaskLotChange);
+  unittest::ExpectEqual(std::string, "+|%symbolChange|%lotChange|@nameSpot", bitmaskSymbolChange.toCSV(sh));
+  unittest::ExpectEqual(std::string, symbolChange.toCSV(sh), bitmaskSymbolChange.toCSV(sh));
+  unittest::ExpectEqual(std::string, symbolChange.toCSV(dsvo::StreamerHelper{';'}), bitmaskSymbolChange.toCSV(dsvo::StreamerHelper{';'}));
+
+  // same merge errors
+  ExpectExceptionMsg( bitmaskVendorA.mergeVersion(bitmaskSymbolChange), dsvo::MergeError_MetaDataSource_exception, \
+    "ERROR(1) :: crtpMetaDataSource<M, CONTAINER>::_checkMergeVersion() : _dataPatch[*] and other._dataPatch[%] both should be of same.");
+  std::cout << "failure_test_end_1" << std::endl;
+  // a re-materialized metaData listing its own data-type
+  const dsvo::MetaDataSource selfMerged("vendorB", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD, std::set<dsvo::t_DataType>{"*vendorB"});
+  const dsvo::BitmaskMetaDataSource bitmaskSelfMerged{selfMerged};
+  dsvo::MetaDataSource vendorCMerge{vendorC};
+  dsvo::BitmaskMetaDataSource bitmaskVendorCMerge{bitmaskVendorC};
+  ExpectExceptionMsg( vendorCMerge.mergeVersion(selfMerged), dsvo::MergeError_MetaDataSource_exception, \
+    "crtpMetaDataSource<M, CONTAINER>::_insert() : insert failed");
+  ExpectExceptionMsg( bitmaskVendorCMerge.mergeVersion(bitmaskSelfMerged), dsvo::MergeError_MetaDataSource_exception, \
+    "BitmaskMetaDataSource::_mergeContainer() : insert failed");
+  std::cout << "failure_test_end_2" << std::endl;
+
+  // registry
+  dsvo::DataTypeRegistry& registry = dsvo::DataTypeRegistry::instance();
+  const dsvo::DataTypeRegistry::t_dataTypeId vendorAId = registry.getId("*vendorA");
+  unittest::ExpectEqual(std::string, "*vendorA", registry.getKey(vendorAId));
+  unittest::ExpectEqual(bool, true, vendorAId == registry.getId("*vendorA"));
+
+  // a VersionedObject over BitmaskMetaDataSource
+  auto versionDate = [](int year) { return t_versionDate{std::chrono::year(year), std::chrono::January, std::chrono::day(unsigned(21))}; };
+  const t_companyInfo companyInfo = t_convertFromString::ToVal("APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED");
+  t_bitmaskVersionObject vendorAVO, vendorBVO, voMerged;
+  vendorAVO.insertVersion(versionDate(2004), t_bitmaskDataSet{bitmaskVendorB, companyInfo});
+  vendorBVO.insertVersion(versionDate(2004), t_bitmaskDataSet{bitmaskVendorC, companyInfo});
+  vendorBVO.insertVersion(versionDate(2014), t_bitmaskDataSet{bitmaskVendorC, companyInfo});
+  t_bitmaskPriorityMerge{vendorAVO, vendorBVO}.getMergeResult(voMerged);
+  const std::string voStr =
+    "21-Jan-2004,*|*vendorB|*vendorC,APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2014,*|*vendorC,APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voStr, t_bitmaskVersionObjectStream::createVOstreamer(voMerged).toCSV(sh));
+
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(sh));
+  }
+
+  // the registry holds at most MAX_DATATYPES keys
+  for(size_t fillerIdx = 0; registry.size() < dsvo::DataTypeRegistry::MAX_DATATYPES; ++fillerIdx)
+    registry.getId("*filler" + std::to_string(fillerIdx));
+  unittest::ExpectEqual(bool, true, vendorAId == registry.getId("*vendorA"));
+  ExpectExceptionMsg( dsvo::BitmaskMetaDataSource("oneTooMany" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD),
+                      dsvo::DataTypeRegistryFull_exception, \
+    "ERROR : DataTypeRegistry::getId() : cannot register dataType-key '*oneTooMany', all 64 ids are in use");
+  std::cout << "failure_test_end_3" << std::endl;
+}
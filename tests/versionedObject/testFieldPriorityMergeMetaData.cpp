@@ -0,0 +1 @@
+#include "testFieldPriorityMergeNoMetaData.cpp"
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <testMergeFixture.h>
+
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+// symbol, name, series, paidUpValue and isin from the exchange ; marketLot from the depository
+using t_exchangeDepositoryPolicy = dsvo::FieldPriorityPolicy< dsvo::eFieldSource::PRIMARY,   dsvo::eFieldSource::PRIMARY,
+                                                              dsvo::eFieldSource::PRIMARY,   dsvo::eFieldSource::PRIMARY,
+                                                              dsvo::eFieldSource::SECONDARY, dsvo::eFieldSource::PRIMARY,
+                                                              dsvo::eFieldSource::PRIMARY,   dsvo::eFieldSource::PRIMARY >;
+using t_versionObjectFieldPriorityMerge =
+        dsvo::VersionedObjectFieldPriorityMerge<t_exchangeDepositoryPolicy, t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const YearlyVersionDate versionDate{std::chrono::April, 1};
+
+  TEST_WITH_METADATA(dsvo::MetaDataSource depositoryMeta("depository" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+
+  // the exchange has a stale market-lot, the depository a stale symbol
+  t_versionObject exchangeVO, depositoryVO;
+  exchangeVO.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo("APPAPER", 1)});
+  exchangeVO.insertVersion(versionDate(2010), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo("IPAPPM", 1)});
+  depositoryVO.insertVersion(versionDate(2002), t_dataSet{TEST_WITH_METADATA(depositoryMeta COMMA) companyInfo("APPM", 5)});
+  depositoryVO.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(depositoryMeta COMMA) companyInfo("APPM", 10)});
+  depositoryVO.insertVersion(versionDate(2012), t_dataSet{TEST_WITH_METADATA(depositoryMeta COMMA) companyInfo("APPM", 20)});
+
+  t_versionObject voMerged;
+  t_versionObjectFieldPriorityMerge{exchangeVO, depositoryVO}.getMergeResult(voMerged);
+
+  const std::string voStr =
+    // before the first exchange version, all fields from the depository
+    "01-Apr-2002," TEST_WITH_METADATA("*|*depository,") "APPM,International Paper APPM Limited,EQ,10,5,INE435A01028,10,LISTED\n"
+    "01-Apr-2004," TEST_WITH_METADATA("*|*exchange|*depository,") "APPAPER,International Paper APPM Limited,EQ,10,10,INE435A01028,10,LISTED\n"
+    // depository's 2004 market-lot still in effect
+    "01-Apr-2010," TEST_WITH_METADATA("*|*exchange,") "IPAPPM,International Paper APPM Limited,EQ,10,10,INE435A01028,10,LISTED\n"
+    // exchange's 2010 symbol still in effect
+    "01-Apr-2012," TEST_WITH_METADATA("*|*depository,") "IPAPPM,International Paper APPM Limited,EQ,10,20,INE435A01028,10,LISTED\n";
+
+  const dsvo::StreamerHelper sh{};
+  unittest::ExpectEqual(std::string, voStr, t_versionObjectStream::createVOstreamer(voMerged).toCSV(TEST_WITH_METADATA(sh)));
+
+  // at each date, the merged record matches the per-field pick of the versions in effect
+  for(const int year : {2002, 2004, 2008, 2010, 2011, 2012, 2020})
+  {
+    const auto exchangeIter = exchangeVO.getVersionAt(versionDate(year));
+    const auto depositoryIter = depositoryVO.getVersionAt(versionDate(year));
+    t_companyInfo expected = exchangeIter != exchangeVO.getDatasetLedger().cend() ? exchangeIter->second.getRecord()
+                                                                                  : depositoryIter->second.getRecord();
+    std::get<4>(expected) = std::get<4>(depositoryIter->second.getRecord());
+    unittest::ExpectEqual(bool, true, expected == voMerged.getVersionAt(versionDate(year))->second.getRecord());
+  }
+
+  // an all-PRIMARY policy keeps the primary's record where the sources disagree
+  using t_allPrimaryPolicy = dsvo::FieldPriorityPolicy< dsvo::eFieldSource::PRIMARY, dsvo::eFieldSource::PRIMARY,
+                                                        dsvo::eFieldSource::PRIMARY, dsvo::eFieldSource::PRIMARY,
+                                                        dsvo::eFieldSource::PRIMARY, dsvo::eFieldSource::PRIMARY,
+                                                        dsvo::eFieldSource::PRIMARY, dsvo::eFieldSource::PRIMARY >;
+  t_versionObject voAllPrimary;
+  dsvo::VersionedObjectFieldPriorityMerge<t_allPrimaryPolicy, t_versionDate, COMPANYMETAINFO_TYPE_LIST>{exchangeVO, depositoryVO}.getMergeResult(voAllPrimary);
+  unittest::ExpectEqual(bool, true, companyInfo("APPAPER", 1) == voAllPrimary.getVersionAt(versionDate(2004))->second.getRecord());
+  unittest::ExpectEqual(bool, true, companyInfo("IPAPPM", 1) == voAllPrimary.getVersionAt(versionDate(2012))->second.getRecord());
+
+  // a single source
+  t_versionObject voSingle;
+  t_versionObjectFieldPriorityMerge{t_versionObject{}, depositoryVO}.getMergeResult(voSingle);
+  unittest::ExpectEqual(t_versionObject, depositoryVO, voSingle);
+
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  // merging into an object holding the same versions is a no-op
+  t_versionObjectFieldPriorityMerge{exchangeVO, depositoryVO}.getMergeResult(voReload);
+  unittest::ExpectEqual(std::string, voStr, t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  unittest::ExpectEqual(t_versionObject, voMerged, voReload);
+}
@@ -0,0 +1,109 @@
+#include <testHelper.h>
+
+#include <versionedObject/InternedMetaData.h>
+#include <versionedObject/VersionedObjectCodec.h>
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+using t_internedMetaData           = dsvo::InternedMetaData<dsvo::MetaDataSource>;
+using t_metaDataPool               = dsvo::MetaDataPool<dsvo::MetaDataSource>;
+using t_internedVersionObject      = dsvo::VersionedObject<t_versionDate, t_internedMetaData, COMPANYINFO_TYPE_LIST>;
+using t_internedDataSet            = dsvo::DataSet<t_internedMetaData, COMPANYINFO_TYPE_LIST>;
+using t_internedPriorityMerge      = dsvo::VersionedObjectPriorityMerge<t_versionDate, t_internedMetaData, COMPANYINFO_TYPE_LIST>;
+using t_internedVersionObjectStream = dsvo::VersionedObjectStream<t_versionDate, t_internedMetaData, COMPANYINFO_TYPE_LIST>;
+using t_versionObjectPriorityMerge = dsvo::VersionedObjectPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const dsvo::StreamerHelper sh{};
+  t_metaDataPool& metaDataPool = t_metaDataPool::instance();
+  const size_t poolSizeAtStart = metaDataPool.size();
+
+  const dsvo::MetaDataSource exchangeMeta("exchange", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  const dsvo::MetaDataSource vendorMeta("vendor", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+
+  // equal values share one pooled instance
+  const t_internedMetaData exchangeA{exchangeMeta}, exchangeB{dsvo::MetaDataSource{exchangeMeta}};
+  const t_internedMetaData vendor{vendorMeta};
+  unittest::ExpectEqual(bool, true, &exchangeA.get() == &exchangeB.get());
+  unittest::ExpectEqual(bool, true, exchangeA == exchangeB);
+  unittest::ExpectEqual(bool, false, exchangeA == vendor);
+  unittest::ExpectEqual(size_t, sizeof(void*), sizeof(t_internedMetaData));
+  unittest::ExpectEqual(std::string, exchangeMeta.toCSV(sh), exchangeA.toCSV(sh));
+  unittest::ExpectEqual(std::string, "*|*exchange", exchangeA.toCSV());
+
+  // a different StreamerHelper is a different value
+  const t_internedMetaData exchangeSemicolon{dsvo::MetaDataSource{"exchange", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD, dsvo::StreamerHelper{';'}}};
+  unittest::ExpectEqual(bool, false, exchangeA == exchangeSemicolon);
+  unittest::ExpectEqual(std::string, "*;*exchange", exchangeSemicolon.toCSV());
+
+  // merges give the pooled merge of the values, memoized
+  dsvo::MetaDataSource expectedMerge{exchangeMeta};
+  expectedMerge.mergeVersion(vendorMeta);
+  t_internedMetaData mergeFirst{exchangeA}, mergeSecond{exchangeB};
+  mergeFirst.mergeVersion(vendor);
+  const size_t poolSizeAfterMerge = metaDataPool.size();
+  mergeSecond.mergeVersion(vendor);
+  unittest::ExpectEqual(dsvo::MetaDataSource, expectedMerge, mergeFirst.get());
+  unittest::ExpectEqual(bool, true, mergeFirst == mergeSecond);
+  unittest::ExpectEqual(size_t, poolSizeAfterMerge, metaDataPool.size());
+  if(firstRun) {
+    unittest::ExpectEqual(size_t, poolSizeAtStart + 4, poolSizeAfterMerge);
+  } else {
+    unittest::ExpectEqual(size_t, poolSizeAtStart, poolSizeAfterMerge);
+  }
+
+  const t_internedMetaData symbolChange{dsvo::MetaDataSource{"symbolChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE}};
+  const t_internedMetaData nameChange{dsvo::MetaDataSource{"nameChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE}};
+  t_internedMetaData comboChange{symbolChange};
+  comboChange.mergeChanges(nameChange);
+  unittest::ExpectEqual(std::string, "+|%symbolChange|%nameChange", comboChange.toCSV(sh));
+
+  // a merge that fails leaves the handle as it was
+  t_internedMetaData failedMerge{exchangeA};
+  ExpectExceptionMsg( failedMerge.mergeVersion(symbolChange), dsvo::MergeError_MetaDataSource_exception, \
+    "ERROR(1) :: crtpMetaDataSource<M, CONTAINER>::_checkMergeVersion() : _dataPatch[*] and other._dataPatch[%] both should be of same.");
+  unittest::ExpectEqual(bool, true, failedMerge == exchangeA);
+  std::cout << "failure_test_end_1" << std::endl;
+
+  // VersionedObject over interned metaData : same result as over MetaDataSource
+  auto versionDate = [](int year) { return t_versionDate{std::chrono::year(year), std::chrono::January, std::chrono::day(unsigned(21))}; };
+  const t_companyInfo companyInfo = t_convertFromString::ToVal("APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED");
+  t_internedVersionObject exchangeVO, vendorVO, voMerged;
+  t_versionObject exchangePlainVO, vendorPlainVO, voPlainMerged;
+  for(int year = 2000; year < 2020; ++year)
+  {
+    if(year % 2 == 0) {
+      exchangeVO.insertVersion(versionDate(year), t_internedDataSet{exchangeA, companyInfo});
+      exchangePlainVO.insertVersion(versionDate(year), t_dataSet{exchangeMeta, companyInfo});
+    }
+    if(year % 3 == 0) {
+      vendorVO.insertVersion(versionDate(year), t_internedDataSet{vendor, companyInfo});
+      vendorPlainVO.insertVersion(versionDate(year), t_dataSet{vendorMeta, companyInfo});
+    }
+  }
+  t_internedPriorityMerge{exchangeVO, vendorVO}.getMergeResult(voMerged);
+  t_versionObjectPriorityMerge{exchangePlainVO, vendorPlainVO}.getMergeResult(voPlainMerged);
+  const std::string voStr = t_versionObjectStream::createVOstreamer(voPlainMerged).toCSV(sh);
+  unittest::ExpectEqual(std::string, voStr, t_internedVersionObjectStream::createVOstreamer(voMerged).toCSV(sh));
+  // every merged date points to the same pooled value
+  unittest::ExpectEqual(bool, true, &mergeFirst.get() == &voMerged.getVersionAt(versionDate(2004))->second.getMetaData().get());
+  std::cout << "merged versions=" << voMerged.getDatasetLedger().size() << std::endl;
+
+  // binary round-trip re-interns the metaData
+  std::string encoded;
+  dsvo::BinaryWriter binaryWriter(encoded);
+  dsvo::BinaryCodec<t_internedVersionObject>::encode(binaryWriter, voMerged);
+  dsvo::BinaryReader binaryReader(encoded.data(), encoded.size());
+  const t_internedVersionObject voDecoded = dsvo::BinaryCodec<t_internedVersionObject>::decode(binaryReader);
+  unittest::ExpectEqual(std::string, voStr, t_internedVersionObjectStream::createVOstreamer(voDecoded).toCSV(sh));
+  unittest::ExpectEqual(bool, true, &mergeFirst.get() == &voDecoded.getVersionAt(versionDate(2010))->second.getMetaData().get());
+
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(sh));
+  }
+  t_versionObjectPriorityMerge{exchangePlainVO, vendorPlainVO}.getMergeResult(voReload);
+  unittest::ExpectEqual(std::string, voStr, t_versionObjectStream::createVOstreamer(voReload).toCSV(sh));
+}
@@ -0,0 +1 @@
+#include "testPriorityMergeAppendNoMetaData.cpp"
\ No newline at end of file
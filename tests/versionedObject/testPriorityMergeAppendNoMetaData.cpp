@@ -0,0 +1,104 @@
+#include <testMergeFixture.h>
+
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+using t_versionObjectPriorityMerge = dsvo::VersionedObjectPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const YearlyVersionDate versionDate{std::chrono::June, 30};
+
+  // exchange : even years 2000..2038, vendor : every third year 2001..2037 ; common years 2004, 2010, ...
+  t_versionObject exchangeVO, vendorVO;
+  for(int year = 2000; year < 2040; year += 2)
+    exchangeVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo(year)});
+  for(int year = 2001; year < 2040; year += 3)
+    vendorVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(year)});
+
+  // expected : built by insertVersion() in reverse date order
+  t_versionObject voExpected;
+  for(int year = 2039; year >= 2000; --year)
+  {
+    const bool inExchange = year % 2 == 0;
+    const bool inVendor = (year - 2001) % 3 == 0;
+    if(inExchange && inVendor) {
+#if TEST_ENABLE_METADATA == 1
+      dsvo::MetaDataSource mergedMeta{exchangeMeta};
+      mergedMeta.mergeVersion(vendorMeta);
+      voExpected.insertVersion(versionDate(year), t_dataSet{mergedMeta, companyInfo(year)});
+#else
+      voExpected.insertVersion(versionDate(year), t_dataSet{companyInfo(year)});
+#endif
+    } else if(inExchange) {
+      voExpected.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo(year)});
+    } else if(inVendor) {
+      voExpected.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(year)});
+    }
+  }
+
+  // appended in date order
+  const t_versionObject::t_generation mergeStart = t_versionObject::getGeneration();
+  t_versionObject voMerged;
+  voMerged.enableChangeTracking();
+  t_versionObjectPriorityMerge{exchangeVO, vendorVO}.getMergeResult(voMerged);
+  unittest::ExpectEqual(t_versionObject, voExpected, voMerged);
+  unittest::ExpectEqual(size_t, size_t(27), voMerged.getDatasetLedger().size());
+  unittest::ExpectEqual(size_t, size_t(27), voMerged.getVersionsInsertedSince(mergeStart).size());
+  std::cout << "merged versions=" << voMerged.getDatasetLedger().size() << std::endl;
+
+  // expendable inputs : versions spliced from the inputs
+  t_versionObject exchangeCopy{exchangeVO}, vendorCopy{vendorVO}, voSpliced;
+  exchangeCopy.enableChangeTracking();
+  voSpliced.enableChangeTracking();
+  t_versionObjectPriorityMerge::getMergeResult(std::move(exchangeCopy), std::move(vendorCopy), voSpliced);
+  unittest::ExpectEqual(t_versionObject, voExpected, voSpliced);
+  unittest::ExpectEqual(bool, true, exchangeCopy.getDatasetLedger().empty() && vendorCopy.getDatasetLedger().empty());
+  unittest::ExpectEqual(size_t, size_t(0), exchangeCopy.getVersionsInsertedSince(0).size());
+  unittest::ExpectEqual(size_t, size_t(27), voSpliced.getVersionsInsertedSince(mergeStart).size());
+
+  // appendVersion() before the last version falls back to insertVersion()
+  unittest::ExpectEqual(bool, false, voSpliced.appendVersion(versionDate(2002), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo(2002)}));
+  unittest::ExpectEqual(bool, true, voSpliced.appendVersion(versionDate(2041), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(2041)}));
+  unittest::ExpectEqual(bool, true, voSpliced.appendVersion(versionDate(1999), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(1999)}));
+  unittest::ExpectEqual(size_t, size_t(29), voSpliced.getDatasetLedger().size());
+  ExpectExceptionMsg( voSpliced.appendVersion(versionDate(2041), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(2040)}),
+                      dsvo::VO_Record_Mismatch_exception, \
+    "ERROR : failure in VersionedObject<VDT, MT...>::insertVersion() : different record exits in _datasetLedger");
+  std::cout << "failure_test_end_1" << std::endl;
+
+  const std::string firstVersionsStr =
+    "30-Jun-2000," TEST_WITH_METADATA("*|*exchange,") "SYM2000,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "30-Jun-2001," TEST_WITH_METADATA("*|*vendor,") "SYM2001,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "30-Jun-2002," TEST_WITH_METADATA("*|*exchange,") "SYM2002,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "30-Jun-2004," TEST_WITH_METADATA("*|*exchange|*vendor,") "SYM2004,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+
+  const dsvo::StreamerHelper sh{};
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  // merging into an object that already holds the versions
+  t_versionObjectPriorityMerge{exchangeVO, vendorVO}.getMergeResult(voReload);
+  unittest::ExpectEqual(t_versionObject, voExpected, voReload);
+  const std::string voStr = t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh));
+  unittest::ExpectEqual(std::string, firstVersionsStr, voStr.substr(0, firstVersionsStr.size()));
+
+  // expendable inputs that disagree
+  {
+    t_versionObject exchangeBad{exchangeVO}, vendorBad{vendorVO}, voMismatch;
+    vendorBad.insertVersion(versionDate(2020), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(2021)});
+    ExpectExceptionMsg( t_versionObjectPriorityMerge::getMergeResult(std::move(exchangeBad), std::move(vendorBad), voMismatch),
+                        dsvo::VOPM_Record_Mismatch_exception, \
+    "ERROR : failure in VersionedObjectPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits between 2 merge-candidates of VersionedObject");
+    std::cout << "failure_test_end_2" << std::endl;
+    // nothing was spliced : the inputs are intact for a retry in conflict-report mode
+    unittest::ExpectEqual(size_t, exchangeVO.getDatasetLedger().size(), exchangeBad.getDatasetLedger().size());
+    unittest::ExpectEqual(size_t, vendorVO.getDatasetLedger().size() + 1, vendorBad.getDatasetLedger().size());
+    unittest::ExpectEqual(size_t, 0, voMismatch.getDatasetLedger().size());
+    std::vector<t_versionObjectPriorityMerge::t_mergeConflict> conflicts;
+    t_versionObjectPriorityMerge{exchangeBad, vendorBad}.getMergeResult(voMismatch, conflicts);
+    unittest::ExpectEqual(bool, false, conflicts.empty());
+  }
+}
@@ -0,0 +1 @@
+#include "testPriorityMergeConflictReportNoMetaData.cpp"
\ No newline at end of file
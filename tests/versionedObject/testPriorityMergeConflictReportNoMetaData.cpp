@@ -0,0 +1,94 @@
+#include <testMergeFixture.h>
+
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+using t_versionObjectPriorityMerge = dsvo::VersionedObjectPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_mergeConflict              = t_versionObjectPriorityMerge::t_mergeConflict;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const YearlyVersionDate versionDate{std::chrono::March, 1};
+
+  // 20 yearly versions in both sources; the vendor disagrees on 3 of them
+  t_versionObject exchangeVO, vendorVO;
+  for(int year = 2004; year < 2024; ++year)
+  {
+    exchangeVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo("APPAPER", 1)});
+    const bool symbolDiffers    = year == 2007 || year == 2019;
+    const bool marketLotDiffers = year == 2011 || year == 2019;
+    vendorVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA)
+                                                        companyInfo(symbolDiffers ? "APPM" : "APPAPER", marketLotDiffers ? 5 : 1)});
+  }
+  // a version held by the vendor only
+  vendorVO.insertVersion(versionDate(2024), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo("ANDPAPER", 1)});
+
+  const t_versionObjectPriorityMerge priorityMerge{exchangeVO, vendorVO};
+
+  // default mode stops at the first conflict
+  {
+    t_versionObject voStrict;
+    ExpectExceptionMsg( priorityMerge.getMergeResult(voStrict),
+                        dsvo::VOPM_Record_Mismatch_exception, \
+    "ERROR : failure in VersionedObjectPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits between 2 merge-candidates of VersionedObject");
+    std::cout << "failure_test_end_1" << std::endl;
+  }
+
+  // conflict-report mode : all conflicts in one pass, resolved by priority
+  std::vector<t_mergeConflict> conflicts;
+  t_versionObject voMerged;
+  priorityMerge.getMergeResult(voMerged, conflicts);
+
+  const std::vector<t_mergeConflict> expectedConflicts{
+    { versionDate(2007), 0, "APPAPER", "APPM" },
+    { versionDate(2011), 4, "1",       "5"    },
+    { versionDate(2019), 0, "APPAPER", "APPM" },
+    { versionDate(2019), 4, "1",       "5"    }
+  };
+  unittest::ExpectEqual(size_t, expectedConflicts.size(), conflicts.size());
+  for(size_t idx = 0; idx < conflicts.size(); ++idx)
+  {
+    std::cout << "conflict : versionDate=" << conflicts[idx].versionDate << " fieldIndex=" << conflicts[idx].fieldIndex
+              << " high=" << conflicts[idx].highPriorityValue << " lowr=" << conflicts[idx].lowrPriorityValue << std::endl;
+    unittest::ExpectEqual(bool, true, expectedConflicts[idx] == conflicts[idx]);
+  }
+
+  unittest::ExpectEqual(size_t, size_t(21), voMerged.getDatasetLedger().size());
+  for(int year = 2004; year < 2024; ++year)
+  {
+    unittest::ExpectEqual(bool, true, companyInfo("APPAPER", 1) == voMerged.getVersionAt(versionDate(year))->second.getRecord());
+  }
+#if TEST_ENABLE_METADATA == 1
+  // conflicting dates merge their metaData as equal records do
+  dsvo::MetaDataSource expectedMeta{exchangeMeta};
+  expectedMeta.mergeVersion(vendorMeta);
+  unittest::ExpectEqual(dsvo::MetaDataSource, expectedMeta, voMerged.getVersionAt(versionDate(2007))->second.getMetaData());
+  unittest::ExpectEqual(dsvo::MetaDataSource, expectedMeta, voMerged.getVersionAt(versionDate(2010))->second.getMetaData());
+#endif
+
+  // the same as the strict merge once the vendor is corrected
+  t_versionObject vendorFixedVO, voStrictFixed;
+  for(int year = 2004; year < 2024; ++year)
+    vendorFixedVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo("APPAPER", 1)});
+  vendorFixedVO.insertVersion(versionDate(2024), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo("ANDPAPER", 1)});
+  t_versionObjectPriorityMerge{exchangeVO, vendorFixedVO}.getMergeResult(voStrictFixed);
+  unittest::ExpectEqual(t_versionObject, voStrictFixed, voMerged);
+
+  const std::string lastVersionStr =
+    "01-Mar-2023," TEST_WITH_METADATA("*|*exchange|*vendor,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "01-Mar-2024," TEST_WITH_METADATA("*|*vendor,") "ANDPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+
+  const dsvo::StreamerHelper sh{};
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  // no conflict against a source holding the merged versions
+  std::vector<t_mergeConflict> noConflicts;
+  t_versionObjectPriorityMerge{voMerged, voMerged}.getMergeResult(voReload, noConflicts);
+  unittest::ExpectEqual(bool, true, noConflicts.empty());
+  unittest::ExpectEqual(t_versionObject, voMerged, voReload);
+  const std::string voStr = t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh));
+  unittest::ExpectEqual(std::string, lastVersionStr, voStr.substr(voStr.size() - lastVersionStr.size()));
+}
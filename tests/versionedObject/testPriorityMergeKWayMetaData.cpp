@@ -0,0 +1 @@
+#include "testPriorityMergeKWayNoMetaData.cpp"
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <testMergeFixture.h>
+
+#include <versionedObject/VersionedObjectPriorityMerge.h>
+
+
+using t_versionObjectPriorityMerge     = dsvo::VersionedObjectPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_versionObjectKWayPriorityMerge = dsvo::VersionedObjectKWayPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const YearlyVersionDate versionDate{std::chrono::January, 21};
+
+  TEST_WITH_METADATA(dsvo::MetaDataSource vendorAMeta("vendorA" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource vendorBMeta("vendorB" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource vendorCMeta("vendorC" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource vendorDMeta("vendorD" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+
+  // four vendor feeds, highest priority first
+  t_versionObject vendorA, vendorB, vendorC, vendorD;
+  vendorA.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(vendorAMeta COMMA) companyInfo("APPAPER")});
+  vendorB.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(vendorBMeta COMMA) companyInfo("APPAPER")});
+  vendorD.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(vendorDMeta COMMA) companyInfo("APPAPER")});
+  vendorC.insertVersion(versionDate(2014), t_dataSet{TEST_WITH_METADATA(vendorCMeta COMMA) companyInfo("IPAPPM")});
+  vendorB.insertVersion(versionDate(2020), t_dataSet{TEST_WITH_METADATA(vendorBMeta COMMA) companyInfo("ANDPAPER")});
+  vendorC.insertVersion(versionDate(2020), t_dataSet{TEST_WITH_METADATA(vendorCMeta COMMA) companyInfo("ANDPAPER")});
+  vendorD.insertVersion(versionDate(2022), t_dataSet{TEST_WITH_METADATA(vendorDMeta COMMA) companyInfo("ANDHRAPAP")});
+
+  // same result as chained pairwise merges
+  t_versionObject voAB, voABC, voChained;
+  t_versionObjectPriorityMerge{vendorA, vendorB}.getMergeResult(voAB);
+  t_versionObjectPriorityMerge{voAB, vendorC}.getMergeResult(voABC);
+  t_versionObjectPriorityMerge{voABC, vendorD}.getMergeResult(voChained);
+
+  const t_versionObjectKWayPriorityMerge kWayMerge{{vendorA, vendorB, vendorC, vendorD}};
+  t_versionObject voMerged;
+  kWayMerge.getMergeResult(voMerged);
+  unittest::ExpectEqual(t_versionObject, voChained, voMerged);
+  unittest::ExpectEqual(size_t, size_t(4), voMerged.getDatasetLedger().size());
+
+#if TEST_ENABLE_METADATA == 1
+  dsvo::MetaDataSource expectedStartMeta{vendorAMeta};
+  expectedStartMeta.mergeVersion(vendorBMeta);
+  expectedStartMeta.mergeVersion(vendorDMeta);
+  unittest::ExpectEqual(dsvo::MetaDataSource, expectedStartMeta, voMerged.getVersionAt(versionDate(2004))->second.getMetaData());
+  // a date held by a single source keeps its metaData as is
+  unittest::ExpectEqual(dsvo::MetaDataSource, vendorCMeta, voMerged.getVersionAt(versionDate(2014))->second.getMetaData());
+#endif
+
+  const std::string voStr =
+    "21-Jan-2004," TEST_WITH_METADATA("*|*vendorA|*vendorB|*vendorD,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2014," TEST_WITH_METADATA("*|*vendorC,") "IPAPPM,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2020," TEST_WITH_METADATA("*|*vendorB|*vendorC,") "ANDPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2022," TEST_WITH_METADATA("*|*vendorD,") "ANDHRAPAP,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+
+  const dsvo::StreamerHelper sh{};
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  // merging into an object holding the same versions is a no-op
+  kWayMerge.getMergeResult(voReload);
+  unittest::ExpectEqual(std::string, voStr, t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  unittest::ExpectEqual(t_versionObject, voMerged, voReload);
+
+  // a single source, and none
+  t_versionObject voSingle, voNone;
+  t_versionObjectKWayPriorityMerge{{vendorC}}.getMergeResult(voSingle);
+  unittest::ExpectEqual(t_versionObject, vendorC, voSingle);
+  t_versionObjectKWayPriorityMerge{{}}.getMergeResult(voNone);
+  unittest::ExpectEqual(bool, true, voNone.getDatasetLedger().empty());
+
+  // different records at the same date
+  vendorA.insertVersion(versionDate(2022), t_dataSet{TEST_WITH_METADATA(vendorAMeta COMMA) companyInfo("ANDHRAPAPER")});
+  {
+    t_versionObject voMismatch;
+    ExpectExceptionMsg( (t_versionObjectKWayPriorityMerge{{vendorA, vendorB, vendorC, vendorD}}.getMergeResult(voMismatch)),
+                        dsvo::VOPM_Record_Mismatch_exception, \
+    "ERROR : failure in VersionedObjectKWayPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits " \
+    "between merge-candidates of VersionedObject");
+
+    std::cout << "failure_test_end_1" << std::endl;
+  }
+}
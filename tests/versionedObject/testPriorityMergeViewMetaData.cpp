@@ -0,0 +1 @@
+#include "testPriorityMergeViewNoMetaData.cpp"
\ No newline at end of file
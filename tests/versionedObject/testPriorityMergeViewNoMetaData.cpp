@@ -0,0 +1,105 @@
+#include <testMergeFixture.h>
+
+#include <versionedObject/VersionedObjectPriorityMergeView.h>
+
+
+using t_versionObjectPriorityMerge     = dsvo::VersionedObjectPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_versionObjectPriorityMergeView = dsvo::VersionedObjectPriorityMergeView<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const YearlyVersionDate versionDate{std::chrono::August, 15};
+
+  // exchange : 2004, 2006, ..., 2022 ; vendor : 2001, 2004, ..., 2022 ; common years 2004, 2010, 2016, 2022
+  t_versionObject exchangeVO, vendorVO;
+  for(int year = 2004; year <= 2022; year += 2)
+    exchangeVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo(year)});
+  for(int year = 2001; year <= 2022; year += 3)
+    vendorVO.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(year)});
+
+  t_versionObject voMerged;
+  t_versionObjectPriorityMerge{exchangeVO, vendorVO}.getMergeResult(voMerged);
+
+  const t_versionObjectPriorityMergeView mergeView{exchangeVO, vendorVO};
+  unittest::ExpectEqual(bool, false, mergeView.empty());
+
+  // iteration yields the merge result
+  auto ledgerIter = voMerged.getDatasetLedger().cbegin();
+  size_t viewVersions = 0;
+  for(const auto& mergedVersion : mergeView)
+  {
+    unittest::ExpectEqual(t_versionDate, ledgerIter->first, mergedVersion.getVersionDate());
+    unittest::ExpectEqual(bool, true, ledgerIter->second.getRecord() == mergedVersion.getRecord());
+#if TEST_ENABLE_METADATA == 1
+    unittest::ExpectEqual(dsvo::MetaDataSource, ledgerIter->second.getMetaData(), mergedVersion.getDataset().getMetaData());
+#endif
+    ++ledgerIter;
+    ++viewVersions;
+  }
+  unittest::ExpectEqual(size_t, voMerged.getDatasetLedger().size(), viewVersions);
+  std::cout << "view versions=" << viewVersions << std::endl;
+
+  // point queries match the merge result, on, between, before and after the versions
+  for(int year = 1999; year <= 2024; ++year)
+  {
+    for(const unsigned day : {14u, 15u, 16u})
+    {
+      const t_versionDate forDate = versionDate(year, day);
+      const auto mergedAt = voMerged.getVersionAt(forDate);
+      const auto viewAt = mergeView.getVersionAt(forDate);
+      unittest::ExpectEqual(bool, mergedAt == voMerged.getDatasetLedger().cend(), viewAt == mergeView.end());
+      if(viewAt != mergeView.end())
+      {
+        unittest::ExpectEqual(t_versionDate, mergedAt->first, (*viewAt).getVersionDate());
+        unittest::ExpectEqual(t_dataSet, mergedAt->second, (*viewAt).getDataset());
+      }
+
+      const auto mergedBefore = voMerged.getVersionBefore(forDate);
+      const auto viewBefore = mergeView.getVersionBefore(forDate);
+      unittest::ExpectEqual(bool, mergedBefore == voMerged.getDatasetLedger().cend(), viewBefore == mergeView.end());
+      if(viewBefore != mergeView.end())
+      {
+        unittest::ExpectEqual(t_versionDate, mergedBefore->first, (*viewBefore).getVersionDate());
+      }
+    }
+  }
+
+  // iteration continues from a point query
+  auto viewIter = mergeView.getVersionAt(versionDate(2010));
+  unittest::ExpectEqual(bool, true, (*viewIter).isFromBothSources());
+  ++viewIter;
+  unittest::ExpectEqual(t_versionDate, versionDate(2012), (*viewIter).getVersionDate());
+  unittest::ExpectEqual(bool, false, (*viewIter++).isFromBothSources());
+  unittest::ExpectEqual(t_versionDate, versionDate(2013), (*viewIter).getVersionDate());
+
+  const t_versionObject emptyVO;
+  unittest::ExpectEqual(bool, true, t_versionObjectPriorityMergeView(emptyVO, emptyVO).empty());
+  unittest::ExpectEqual(bool, true, t_versionObjectPriorityMergeView(emptyVO, emptyVO).begin() ==
+                                    t_versionObjectPriorityMergeView(emptyVO, emptyVO).end());
+
+  // the view reads through to the sources
+  if(firstRun) {
+    const dsvo::StreamerHelper sh{};
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  voReload = voMerged;
+  t_versionObject vendorLate;
+  vendorLate.insertVersion(versionDate(2030), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(2030)});
+  const t_versionObjectPriorityMergeView reloadView{voReload, vendorLate};
+  unittest::ExpectEqual(t_versionDate, versionDate(2022), (*reloadView.getVersionBefore(versionDate(2030))).getVersionDate());
+  unittest::ExpectEqual(t_versionDate, versionDate(2030), (*reloadView.getVersionAt(versionDate(2031))).getVersionDate());
+
+  // a conflicting date fails only when it is dereferenced
+  vendorVO.insertVersion(versionDate(2018), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) companyInfo(2019)});
+  {
+    const t_versionObjectPriorityMergeView conflictView{exchangeVO, vendorVO};
+    unittest::ExpectEqual(t_versionDate, versionDate(2016), (*conflictView.getVersionAt(versionDate(2017))).getVersionDate());
+    const auto conflictIter = conflictView.getVersionAt(versionDate(2018));
+    ExpectExceptionMsg( *conflictIter,
+                        dsvo::VOPM_Record_Mismatch_exception, \
+    "ERROR : failure in VersionedObjectPriorityMergeView<VDT, MT...>::const_iterator::operator*() : different 'record' exits between 2 merge-candidates of VersionedObject");
+    std::cout << "failure_test_end_1" << std::endl;
+  }
+}
@@ -0,0 +1 @@
+#include "testVersionedObjectChangeFeedNoMetaData.cpp"
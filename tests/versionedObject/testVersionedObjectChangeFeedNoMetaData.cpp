@@ -0,0 +1,113 @@
+#include <testMergeFixture.h>
+
+#include <versionedObject/VersionedObjectUniverseStream.h>
+
+
+using t_versionObjectUniverseStream = dsvo::VersionedObjectUniverseStream<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+void loadVO(t_versionObject& vo,
+            bool insertResultExpected)
+{
+  TEST_WITH_METADATA(dsvo::MetaDataSource listingMeta("listing" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource lotChgMeta("marketLotChange" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::DELTACHANGE));
+
+  const YearlyVersionDate versionDate{std::chrono::May, 13};
+  auto isinInfo = [](const std::string& isin, int marketLot)
+  {
+    t_companyInfo info = companyInfo("APPAPER", static_cast<t_marketLot>(marketLot));
+    std::get<5>(info) = isin;
+    return info;
+  };
+
+  const dsvo::StreamerHelper sh{};
+  const std::string isin{"INE435A01028"};
+
+  bool insertResult = vo.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) isinInfo(isin, 1)});
+  unittest::ExpectEqual(bool, insertResultExpected, insertResult);
+  // 'vo' is shared by both loadVO() calls, the feed is checked on an object built afresh in each call
+  t_versionObject feedVO;
+  feedVO.enableChangeTracking();
+  feedVO.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) isinInfo(isin, 1)});
+  feedVO.insertVersion(versionDate(2008), t_dataSet{TEST_WITH_METADATA(lotChgMeta COMMA) isinInfo(isin, 5)});
+
+  const t_versionObject::t_generation firstPull = t_versionObject::getGeneration();
+
+  // nothing inserted since the pull, re-inserting the same record is a no-op
+  feedVO.insertVersion(versionDate(2008), t_dataSet{TEST_WITH_METADATA(lotChgMeta COMMA) isinInfo(isin, 5)});
+  unittest::ExpectEqual(size_t, size_t(0), feedVO.getVersionsInsertedSince(firstPull).size());
+  unittest::ExpectEqual(std::string, std::string(""), [&]() {
+    std::ostringstream oss;
+    t_versionObjectStream::createVOstreamer(feedVO).toCSVSince(firstPull, "", oss, sh);
+    return oss.str(); }());
+
+  // a late-arriving back-dated version and a new latest version
+  feedVO.insertVersion(versionDate(2012), t_dataSet{TEST_WITH_METADATA(lotChgMeta COMMA) isinInfo(isin, 10)});
+  feedVO.insertVersion(versionDate(2006), t_dataSet{TEST_WITH_METADATA(lotChgMeta COMMA) isinInfo(isin, 2)});
+
+  std::ostringstream sinceFeed;
+  t_versionObjectStream::createVOstreamer(feedVO).toCSVSince(firstPull, "", sinceFeed, sh);
+  unittest::ExpectEqual(std::string,
+    "13-May-2006," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,2,INE435A01028,10,LISTED\n"
+    "13-May-2012," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,10,INE435A01028,10,LISTED\n",
+    sinceFeed.str());
+
+  std::ostringstream fromFeed;
+  t_versionObjectStream::createVOstreamer(feedVO).toCSVFrom(versionDate(2008), "", fromFeed, sh);
+  unittest::ExpectEqual(std::string,
+    "13-May-2008," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,5,INE435A01028,10,LISTED\n"
+    "13-May-2012," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,10,INE435A01028,10,LISTED\n",
+    fromFeed.str());
+
+  // the generation-stamps do not take part in equality
+  t_versionObject sameVersions;
+  for(const auto& [date, dataset] : feedVO.getDatasetLedger())
+    sameVersions.insertVersion(date, dataset);
+  unittest::ExpectEqual(bool, true, sameVersions == feedVO);
+
+  // universe : one watermark covers all objects
+  std::map<std::string, t_versionObject> universe;
+  universe[isin] = feedVO;   // a copy keeps the insertion-log
+  for(const char* objectKey : {"INE001A01028", "INE002A01028", "INE003A01028"})
+    universe[objectKey].enableChangeTracking();
+  universe["INE001A01028"].insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) isinInfo("INE001A01028", 1)});
+  universe["INE002A01028"].insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) isinInfo("INE002A01028", 1)});
+
+  const t_versionObject::t_generation universePull = t_versionObject::getGeneration();
+  universe["INE002A01028"].insertVersion(versionDate(2010), t_dataSet{TEST_WITH_METADATA(lotChgMeta COMMA) isinInfo("INE002A01028", 3)});
+  universe["INE003A01028"].insertVersion(versionDate(2011), t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) isinInfo("INE003A01028", 1)});
+
+  std::ostringstream universeSinceFeed;
+  t_versionObjectUniverseStream::toCSVSince(universe, universePull, universeSinceFeed, sh);
+  unittest::ExpectEqual(std::string,
+    "INE002A01028,13-May-2010," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,3,INE002A01028,10,LISTED\n"
+    "INE003A01028,13-May-2011," TEST_WITH_METADATA("*|*listing,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE003A01028,10,LISTED\n",
+    universeSinceFeed.str());
+
+  std::ostringstream universeFromFeed;
+  t_versionObjectUniverseStream::toCSVFrom(universe, versionDate(2011), universeFromFeed, sh);
+  unittest::ExpectEqual(std::string,
+    "INE003A01028,13-May-2011," TEST_WITH_METADATA("*|*listing,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE003A01028,10,LISTED\n"
+    "INE435A01028,13-May-2012," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,10,INE435A01028,10,LISTED\n",
+    universeFromFeed.str());
+
+  // the full export is the feed from generation 0
+  std::ostringstream fullExport;
+  std::ostringstream feedFromStart;
+  t_versionObjectUniverseStream::toCSVSequential(universe, fullExport, sh);
+  t_versionObjectUniverseStream::toCSVSince(universe, 0, feedFromStart, sh);
+  unittest::ExpectEqual(std::string, fullExport.str(), feedFromStart.str());
+
+  // once acknowledged, the log is trimmed up to the pull
+  t_versionObject& trimmedVO = universe["INE002A01028"];
+  unittest::ExpectEqual(size_t, size_t(1), trimmedVO.trimInsertionLogUpTo(universePull));
+  unittest::ExpectEqual(size_t, size_t(1), trimmedVO.getVersionsInsertedSince(universePull).size());
+  unittest::ExpectEqual(size_t, size_t(1), trimmedVO.getVersionsInsertedSince(0).size());
+
+  // tracking is opt-in : an untracked object keeps no log
+  t_versionObject untrackedVO;
+  untrackedVO.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) isinInfo(isin, 1)});
+  unittest::ExpectEqual(bool, false, untrackedVO.isChangeTracked());
+  ExpectException( untrackedVO.getVersionsInsertedSince(0), dsvo::ChangeTracking_Disabled_exception );
+  untrackedVO.enableChangeTracking();   // existing versions are stamped on enabling
+  unittest::ExpectEqual(size_t, size_t(1), untrackedVO.getVersionsInsertedSince(universePull).size());
+}
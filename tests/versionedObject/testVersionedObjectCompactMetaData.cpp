@@ -0,0 +1 @@
+#include "testVersionedObjectCompactNoMetaData.cpp"
\ No newline at end of file
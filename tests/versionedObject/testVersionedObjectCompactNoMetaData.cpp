@@ -0,0 +1,112 @@
+#include <testHelper.h>
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const dsvo::StreamerHelper sh{};
+  auto versionDate = [](int year) { return t_versionDate{std::chrono::year(year), std::chrono::January, std::chrono::day(unsigned(21))}; };
+  const t_companyInfo paperInfo = t_convertFromString::ToVal("APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED");
+  const t_companyInfo andhraInfo = t_convertFromString::ToVal("ANDHRAPAP,ANDHRA PAPER LIMITED,EQ,10,1,INE435A01028,10,LISTED");
+
+  TEST_WITH_METADATA(const dsvo::MetaDataSource exchangeMeta("exchange" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(const dsvo::MetaDataSource vendorMeta("vendor" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+
+  // 2002 confirms 2001, 2004 and 2005 confirm 2003
+  t_versionObject vo;
+  vo.enableChangeTracking();   // copies below are tracked as well
+  vo.insertVersion(versionDate(2001), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) paperInfo});
+  vo.insertVersion(versionDate(2002), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) paperInfo});
+  vo.insertVersion(versionDate(2005), t_dataSet{TEST_WITH_METADATA(vendorMeta COMMA) andhraInfo});
+  vo.insertVersion(versionDate(2003), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) andhraInfo});
+  vo.insertVersion(versionDate(2004), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) andhraInfo});
+  vo.insertVersion(versionDate(2006), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) paperInfo});
+
+  t_versionObject voDrop{vo}, voFold{vo};
+  unittest::ExpectEqual(size_t, size_t(0), voDrop.compact(dsvo::eCompactPolicy::NONE));
+  unittest::ExpectEqual(size_t, size_t(6), voDrop.getDatasetLedger().size());
+
+  // DROP : the first version of each run of same records is kept as it was
+  const t_versionObject::t_generation beforeDrop = t_versionObject::getGeneration();
+  unittest::ExpectEqual(size_t, size_t(3), voDrop.compact(dsvo::eCompactPolicy::DROP));
+  const std::string voDropStr =
+    "21-Jan-2001," TEST_WITH_METADATA("*|*exchange,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2003," TEST_WITH_METADATA("*|*exchange,") "ANDHRAPAP,ANDHRA PAPER LIMITED,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2006," TEST_WITH_METADATA("*|*exchange,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voDropStr, t_versionObjectStream::createVOstreamer(voDrop).toCSV(TEST_WITH_METADATA(sh)));
+  unittest::ExpectEqual(size_t, size_t(0), voDrop.getVersionsInsertedSince(beforeDrop).size());
+  unittest::ExpectEqual(size_t, size_t(3), voDrop.getVersionsInsertedSince(0).size());
+  unittest::ExpectEqual(size_t, size_t(0), voDrop.compact(dsvo::eCompactPolicy::DROP));
+
+  // every date reads the same record as before
+  for(int year = 2000; year <= 2007; ++year)
+  {
+    const auto versionIter = vo.getVersionAt(versionDate(year));
+    const auto compactIter = voDrop.getVersionAt(versionDate(year));
+    unittest::ExpectEqual(bool, versionIter == vo.getDatasetLedger().cend(), compactIter == voDrop.getDatasetLedger().cend());
+    if(versionIter != vo.getDatasetLedger().cend())
+    {
+      unittest::ExpectEqual(t_dataSet, versionIter->second, compactIter->second);
+    }
+  }
+
+  // FOLD : the metaData of the versions removed is merged into the one kept, which is re-stamped
+  const t_versionObject::t_generation beforeFold = t_versionObject::getGeneration();
+  unittest::ExpectEqual(size_t, size_t(3), voFold.compact(dsvo::eCompactPolicy::FOLD));
+  const std::string voFoldStr =
+    "21-Jan-2001," TEST_WITH_METADATA("*|*exchange|*vendor,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2003," TEST_WITH_METADATA("*|*exchange|*vendor,") "ANDHRAPAP,ANDHRA PAPER LIMITED,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2006," TEST_WITH_METADATA("*|*exchange,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voFoldStr, t_versionObjectStream::createVOstreamer(voFold).toCSV(TEST_WITH_METADATA(sh)));
+  unittest::ExpectEqual(bool, true, voDrop == voFold);
+  unittest::ExpectEqual(size_t, size_t(TEST_ALTERNATE_METADATA(2, 0)), voFold.getVersionsInsertedSince(beforeFold).size());
+  unittest::ExpectEqual(size_t, size_t(3), voFold.getVersionsInsertedSince(0).size());
+
+#if TEST_ENABLE_METADATA == 1
+  // a FOLD that cannot merge the metaData ( DELTACHANGE into FullRECORD ) keeps that version,
+  // and folds the same-record versions after it into it
+  const dsvo::MetaDataSource symbolChangeMeta("symbolChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE);
+  const dsvo::MetaDataSource nameChangeMeta("nameChange", t_eDataBuild::FORWARD, t_eDataPatch::DELTACHANGE);
+  t_versionObject voMixedFold{vo};
+  voMixedFold.insertVersion(versionDate(2007), t_dataSet{symbolChangeMeta, paperInfo});
+  voMixedFold.insertVersion(versionDate(2008), t_dataSet{nameChangeMeta, paperInfo});
+  unittest::ExpectEqual(size_t, size_t(4), voMixedFold.compact(dsvo::eCompactPolicy::FOLD));
+  const std::string voMixedFoldStr = voFoldStr +
+    "21-Jan-2007,+|%symbolChange|%nameChange,APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voMixedFoldStr, t_versionObjectStream::createVOstreamer(voMixedFold).toCSV(sh));
+  unittest::ExpectEqual(size_t, size_t(4), voMixedFold.getVersionsInsertedSince(0).size());
+  unittest::ExpectEqual(size_t, size_t(0), voMixedFold.compact(dsvo::eCompactPolicy::FOLD));
+  unittest::ExpectEqual(size_t, size_t(1), voMixedFold.compact(dsvo::eCompactPolicy::DROP));
+  unittest::ExpectEqual(bool, true, voDrop == voMixedFold);
+#endif
+
+  // as a post-build step : a snapshot confirming the market-lot adds no version
+  t_versionObjectBuilder vob;
+  unittest::ExpectEqual(bool, true, dsvo::eCompactPolicy::NONE == vob.getPostBuildCompaction());
+  vob.setPostBuildCompaction(dsvo::eCompactPolicy::DROP);
+  const std::array <bool, std::tuple_size_v<t_companyInfo> > lotChangeFlg = {false, false, false, false, true, false, false, false};
+  TEST_WITH_METADATA(const dsvo::MetaDataSource lotChgMeta("marketLotSpot" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::SNAPSHOT));
+  t_snapshotDataSet lotConfirm {lotChangeFlg, t_convertFromString::ToVal(",,,0,1,,0,"),
+                                TEST_ALTERNATE_METADATA(lotChgMeta, t_eDataBuild::FORWARD)};
+  vob.insertSnapshotVersion(versionDate(2010), lotConfirm);
+  t_versionObject voBuilt{voDrop};
+  vob.buildForwardTimeline(voBuilt);
+  unittest::ExpectEqual(std::string, voDropStr, t_versionObjectStream::createVOstreamer(voBuilt).toCSV(TEST_WITH_METADATA(sh)));
+
+#if TEST_ENABLE_METADATA == 1
+  // FOLD cannot merge the SNAPSHOT metaData into the FullRECORD one : the confirming version is kept
+  vob.setPostBuildCompaction(dsvo::eCompactPolicy::FOLD);
+  vob.insertSnapshotVersion(versionDate(2010), lotConfirm);
+  t_versionObject voBuiltFold{voDrop};
+  vob.buildForwardTimeline(voBuiltFold);
+  unittest::ExpectEqual(size_t, size_t(4), voBuiltFold.getDatasetLedger().size());
+  unittest::ExpectEqual(bool, true, paperInfo == voBuiltFold.getDatasetLedger().crbegin()->second.getRecord());
+#endif
+
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  voReload = vo;
+  voReload.compact(dsvo::eCompactPolicy::DROP);
+  unittest::ExpectEqual(std::string, voDropStr, t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+}
@@ -0,0 +1 @@
+#include "testVersionedObjectJournalNoMetaData.cpp"
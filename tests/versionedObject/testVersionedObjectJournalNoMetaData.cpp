@@ -0,0 +1,123 @@
+#include <testHelper.h>
+
+#include <versionedObject/VersionedObjectJournal.h>
+
+
+using t_versionObjectJournal = dsvo::VersionedObjectJournal<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_journaledBuilder = dsvo::JournaledVersionedObjectBuilder<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_journaledVersionObject = dsvo::JournaledVersionedObject<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+void loadVO(t_versionObject& vo,
+            bool insertResultExpected)
+{
+  const std::string journalPath = unittest::TempPath();
+  const std::string objectKey{"INE435A01028"};
+  t_versionObjectBuilder vob;
+
+  TEST_WITH_METADATA(dsvo::MetaDataSource symChgMeta("symbolChange" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::DELTACHANGE));
+  TEST_WITH_METADATA(dsvo::MetaDataSource namSpotMeta("nameSpot"   COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::SNAPSHOT));
+  TEST_WITH_METADATA(dsvo::MetaDataSource manualMeta("manualDeduction" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+
+  const std::array <bool, std::tuple_size_v<t_companyInfo> > symbolChangeFlg = {true, false, false, false, false, false, false, false};
+  const std::array <bool, std::tuple_size_v<t_companyInfo> >   nameChangeFlg = {false, true, false, false, false, false, false, false};
+
+  const t_versionDate listingDate{std::chrono::year(int(2004)), std::chrono::May, std::chrono::day(unsigned(13))};
+  const t_versionDate symChgDate1{std::chrono::year(int(2014)), std::chrono::January, std::chrono::day(unsigned(21))};
+  const t_versionDate symChgDate2{std::chrono::year(int(2020)), std::chrono::January, std::chrono::day(unsigned(22))};
+
+  t_companyInfo companyInfoStart = t_convertFromString::ToVal(
+    "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED"    );
+  t_dataSet companyRecordStart {TEST_WITH_METADATA(manualMeta COMMA) companyInfoStart};
+
+  {
+    t_versionObjectJournal journal{journalPath, 2, std::chrono::milliseconds{0}};   // fsync after every 2 records
+    t_journaledBuilder jvob{vob, journal, objectKey};
+    t_journaledVersionObject jvo{vo, journal, objectKey};
+
+    bool insertResult = jvo.insertVersion(listingDate, companyRecordStart);
+    unittest::ExpectEqual(bool, insertResultExpected, insertResult);
+
+    t_changesInDataSet symbolChange1 {symbolChangeFlg, t_convertFromString::ToVal("APPAPER,,,0,0,,0,"),
+                                      t_convertFromString::ToVal("IPAPPM,,,0,0,,0,"),
+                                      TEST_ALTERNATE_METADATA(symChgMeta, t_eDataBuild::FORWARD)};
+    insertResult = jvob.insertDeltaVersion(symChgDate1, symbolChange1);
+    unittest::ExpectEqual(bool, true, insertResult);
+
+    t_snapshotDataSet companyNameKeyDataSet1 {nameChangeFlg, t_convertFromString::ToVal(",International Paper APPM Limited,,0,0,,0,"),
+                                              TEST_ALTERNATE_METADATA(namSpotMeta, t_eDataBuild::FORWARD)};
+    insertResult = jvob.insertSnapshotVersion(symChgDate1, companyNameKeyDataSet1);
+    unittest::ExpectEqual(bool, true, insertResult);
+
+    t_changesInDataSet symbolChange2 {symbolChangeFlg, t_convertFromString::ToVal("IPAPPM,,,0,0,,0,"),
+                                      t_convertFromString::ToVal("ANDPAPER,,,0,0,,0,"),
+                                      TEST_ALTERNATE_METADATA(symChgMeta, t_eDataBuild::FORWARD)};
+    insertResult = jvob.insertDeltaVersion(symChgDate2, symbolChange2);
+    unittest::ExpectEqual(bool, true, insertResult);
+
+    unittest::ExpectEqual(size_t, (insertResultExpected ? 0 : 1), journal.getPendingRecords());
+  } // journal destructor commits the pending group
+
+
+  std::map<std::string, t_versionObjectBuilder> replayedBuilders;
+  std::map<std::string, t_versionObject> replayedVOs;
+  dsvo::JournalReplayResult replayResult = t_versionObjectJournal::replay(journalPath, replayedBuilders, replayedVOs);
+  unittest::ExpectEqual(size_t, (insertResultExpected ? 4 : 3), replayResult.records);
+  unittest::ExpectEqual(bool, false, replayResult.isTailTruncated);
+  unittest::ExpectEqual(size_t, 1, replayedBuilders.size());
+  unittest::ExpectEqual(size_t, (insertResultExpected ? 1 : 0), replayedVOs.size());
+
+  t_versionObject& replayedVO = replayedVOs[objectKey];
+  if(!insertResultExpected)   // identical re-insert is not journaled
+    replayedVO.insertVersion(listingDate, companyRecordStart);
+
+  replayedBuilders[objectKey].buildForwardTimeline(replayedVO);
+  vob.buildForwardTimeline(vo);
+
+  const dsvo::StreamerHelper sh{};
+  std::string voStrForward =
+    "13-May-2004," TEST_WITH_METADATA("*|*manualDeduction,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2014," TEST_WITH_METADATA("+|%symbolChange|@nameSpot,") "IPAPPM,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "22-Jan-2020," TEST_WITH_METADATA("+|%symbolChange,") "ANDPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voStrForward, t_versionObjectStream::createVOstreamer(vo).toCSV(TEST_WITH_METADATA(sh)));
+  unittest::ExpectEqual(std::string, voStrForward, t_versionObjectStream::createVOstreamer(replayedVO).toCSV(TEST_WITH_METADATA(sh)));
+
+
+  // simulate a crash in the middle of a group commit : torn record at the tail
+  const std::string journalContent = unittest::ReadFile(journalPath);
+  unittest::WriteFile(journalPath, journalContent + std::string("\x30\x00\x00\x00\x01\x0c", 6));
+
+  replayedBuilders.clear();
+  replayedVOs.clear();
+  replayResult = t_versionObjectJournal::replay(journalPath, replayedBuilders, replayedVOs);
+  unittest::ExpectEqual(size_t, (insertResultExpected ? 4 : 3), replayResult.records);
+  unittest::ExpectEqual(bool, true, replayResult.isTailTruncated);
+  unittest::ExpectEqual(uintmax_t, journalContent.size(), replayResult.validBytes);
+
+  {
+    t_versionObjectJournal journal{journalPath};   // re-open recovers the torn tail
+  }
+  unittest::ExpectEqual(std::string, journalContent, unittest::ReadFile(journalPath));
+
+  // a group that never fills up is committed once its oldest record is 'maxCommitDelay' old
+  {
+    t_versionObjectJournal journal{journalPath, 1000, std::chrono::milliseconds{20}};
+    journal.appendVersion(objectKey, symChgDate2, companyRecordStart);
+    for(int retry = 0; retry < 1000 && journal.getPendingRecords() > 0; ++retry)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    unittest::ExpectEqual(size_t, 0, journal.getPendingRecords());
+  }
+  replayResult = t_versionObjectJournal::replay(journalPath, [](auto&&...) {}, [](auto&&...) {}, [](auto&&...) {});
+  unittest::ExpectEqual(size_t, (insertResultExpected ? 5 : 4), replayResult.records);
+
+  // a corrupt record followed by committed ones is not a torn tail : replay and re-open refuse it
+  std::string corruptContent = unittest::ReadFile(journalPath);
+  corruptContent[t_versionObjectJournal::MAGIC.size() + sizeof(uint32_t)] ^= 0x7f;
+  unittest::WriteFile(journalPath, corruptContent);
+  ExpectException(t_versionObjectJournal::replay(journalPath, replayedBuilders, replayedVOs), dsvo::VO_Journal_IO_exception);
+  ExpectException(t_versionObjectJournal{journalPath}, dsvo::VO_Journal_IO_exception);
+  unittest::ExpectEqual(std::string, corruptContent, unittest::ReadFile(journalPath));
+
+  unittest::DeleteFile(journalPath);
+}
@@ -0,0 +1 @@
+#include "testVersionedObjectPipelineNoMetaData.cpp"
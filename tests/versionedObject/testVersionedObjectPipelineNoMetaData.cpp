@@ -0,0 +1,164 @@
+#include <testHelper.h>
+
+#include <versionedObject/VersionedObjectPipeline.h>
+#include <versionedObject/VersionedObjectUniverseStream.h>
+
+
+using t_versionObjectPipeline = dsvo::VersionedObjectPipeline<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_versionObjectUniverseStream = dsvo::VersionedObjectUniverseStream<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+void loadVO(t_versionObject& vo,
+            bool insertResultExpected)
+{
+  TEST_WITH_METADATA(dsvo::MetaDataSource listingMeta("listing" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource lotChgMeta("marketLotChange" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::DELTACHANGE));
+
+  const t_versionDate listingDate{std::chrono::year(int(2004)), std::chrono::May, std::chrono::day(unsigned(13))};
+  const t_companyInfo companyInfo = t_convertFromString::ToVal(
+    "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED"    );
+  bool insertResult = vo.insertVersion(listingDate, t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) companyInfo});
+  unittest::ExpectEqual(bool, insertResultExpected, insertResult);
+
+  /*
+   * input line :   objectKey,year,R,<companyInfo>     full record on 13-May-<year>
+   *                objectKey,year,D,oldLot,newLot      marketLot delta-change on 13-May-<year>
+   *                # ...                               comment, skipped
+   */
+  const std::array<bool, std::tuple_size_v<t_companyInfo>> lotChangeFlg = {false, false, false, false, true, false, false, false};
+  const t_versionObjectPipeline::t_parser parser =
+    [&](const std::string& line) -> std::optional<t_versionObjectPipeline::t_parsedRow>
+    {
+      if(line.empty() || line[0] == '#')
+        return std::nullopt;
+      const size_t keyEnd  = line.find(',');
+      const size_t yearEnd = line.find(',', keyEnd + 1);
+      const std::string objectKey = line.substr(0, keyEnd);
+      const t_versionDate versionDate{std::chrono::year(std::stoi(line.substr(keyEnd + 1, yearEnd - keyEnd - 1))),
+                                      std::chrono::May, std::chrono::day(unsigned(13))};
+      const std::string fields = line.substr(yearEnd + 3);
+      if(line[yearEnd + 1] == 'R')
+      {
+        return t_versionObjectPipeline::t_parsedRow{objectKey, versionDate,
+                 t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) t_convertFromString::ToVal(fields)}};
+      }
+      const size_t lotEnd = fields.find(',');
+      t_companyInfo oldInfo = t_convertFromString::ToVal(",,,0,0,,0,");
+      t_companyInfo newInfo = oldInfo;
+      std::get<4>(oldInfo) = static_cast<t_marketLot>(std::stoi(fields.substr(0, lotEnd)));
+      std::get<4>(newInfo) = static_cast<t_marketLot>(std::stoi(fields.substr(lotEnd + 1)));
+      return t_versionObjectPipeline::t_parsedRow{objectKey, versionDate,
+               t_changesInDataSet{lotChangeFlg, oldInfo, newInfo,
+                                  TEST_ALTERNATE_METADATA(lotChgMeta, t_eDataBuild::FORWARD)}};
+    };
+
+  // universe of full-record objects with skewed sizes : object 'iii' has (iii % 7)+1 versions
+  std::map<std::string, t_versionObject> expectedUniverse;
+  std::ostringstream universeInput;
+  universeInput << "# objectKey,year,R|D,...\n";
+  for(int iii = 0; iii < 41; ++iii)
+  {
+    std::ostringstream objectKey;
+    objectKey << "INE" << std::setw(3) << std::setfill('0') << iii << "A01028";
+    for(int jjj = 0; jjj <= (iii % 7); ++jjj)
+    {
+      std::ostringstream fields;
+      fields << "SYM" << iii << ",International Paper APPM Limited,EQ,10," << (jjj + 1) << ',' << objectKey.str() << ",10,LISTED";
+      universeInput << objectKey.str() << ',' << (2004 + jjj) << ",R," << fields.str() << '\n';
+      const t_versionDate versionDate{std::chrono::year(int(2004 + jjj)), std::chrono::May, std::chrono::day(unsigned(13))};
+      expectedUniverse[objectKey.str()].insertVersion(versionDate,
+                         t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) t_convertFromString::ToVal(fields.str())});
+    }
+  }
+
+  const dsvo::StreamerHelper sh{};
+  std::ostringstream expectedExport;
+  t_versionObjectUniverseStream::toCSVSequential(expectedUniverse, expectedExport, sh);
+
+  // full records need no build step; a queue-capacity of 2 keeps every stage under backpressure
+  for(const size_t queueCapacity : std::vector<size_t>{2, 1024})
+  {
+    std::ostringstream pipelineExport;
+    size_t builtObjects = 0;
+    t_versionObjectPipeline pipeline{parser,
+      [&builtObjects](const std::string&, t_versionObjectBuilder&, t_versionObject&) { ++builtObjects; },
+      t_versionObjectPipeline::csvExporter(pipelineExport, sh),
+      queueCapacity};
+    std::istringstream input{universeInput.str()};
+    pipeline.run(input);
+    unittest::ExpectEqual(std::string, expectedExport.str(), pipelineExport.str());
+    unittest::ExpectEqual(size_t, expectedUniverse.size(), builtObjects);
+
+    const auto& metrics = pipeline.getMetrics();
+    unittest::ExpectEqual(std::string, std::string("parse"),  metrics[t_versionObjectPipeline::PARSE].stageName);
+    unittest::ExpectEqual(std::string, std::string("export"), metrics[t_versionObjectPipeline::EXPORT].stageName);
+    unittest::ExpectEqual(size_t, size_t(1+161), metrics[t_versionObjectPipeline::PARSE].itemsIn);   // lines incl. comment
+    unittest::ExpectEqual(size_t, size_t(161),   metrics[t_versionObjectPipeline::PARSE].itemsOut);  // rows
+    unittest::ExpectEqual(size_t, size_t(161),   metrics[t_versionObjectPipeline::GROUP].itemsIn);
+    for(const size_t stage : std::vector<size_t>{t_versionObjectPipeline::GROUP, t_versionObjectPipeline::INSERT,
+                                                 t_versionObjectPipeline::BUILD, t_versionObjectPipeline::EXPORT})
+    {
+      unittest::ExpectEqual(size_t, expectedUniverse.size(), metrics[stage].itemsOut);
+    }
+    unittest::ExpectEqual(bool, true, metrics[t_versionObjectPipeline::EXPORT].throughput(pipeline.getWallTime()) > 0.0);
+  }
+
+  // a slow exporter : the build stage stalls on the full queue, and that wait is not counted as busy
+  {
+    std::ostringstream pipelineExport;
+    const t_versionObjectPipeline::t_export csvExport = t_versionObjectPipeline::csvExporter(pipelineExport, sh);
+    t_versionObjectPipeline pipeline{parser,
+      [](const std::string&, t_versionObjectBuilder&, t_versionObject&) {},
+      [&csvExport](const std::string& objectKey, const t_versionObject& pipelineVO)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        csvExport(objectKey, pipelineVO);
+      },
+      1};
+    std::istringstream input{universeInput.str()};
+    pipeline.run(input);
+    unittest::ExpectEqual(std::string, expectedExport.str(), pipelineExport.str());
+
+    const dsvo::PipelineStageMetrics& buildMetrics = pipeline.getMetrics()[t_versionObjectPipeline::BUILD];
+    unittest::ExpectEqual(bool, true, buildMetrics.stallTime.count() > 0);
+    unittest::ExpectEqual(bool, true, buildMetrics.busyTime + buildMetrics.stallTime <= pipeline.getWallTime());
+  }
+
+  // deltas are collected by the builder and applied in the build stage
+  // ( a single object, so the builder debug-log is not interleaved across stages )
+  {
+    std::ostringstream deltaInput;
+    deltaInput << "INE435A01028,2004,R,APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+               << "INE435A01028,2006,D,1,5\n"
+               << "INE435A01028,2009,D,5,10\n";
+    std::ostringstream pipelineExport;
+    t_versionObjectPipeline pipeline{parser,
+      [](const std::string&, t_versionObjectBuilder& vob, t_versionObject& pipelineVO) { vob.buildForwardTimeline(pipelineVO); },
+      t_versionObjectPipeline::csvExporter(pipelineExport, sh)};
+    std::istringstream input{deltaInput.str()};
+    pipeline.run(input);
+    unittest::ExpectEqual(std::string,
+      "INE435A01028,13-May-2004," TEST_WITH_METADATA("*|*listing,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+      "INE435A01028,13-May-2006," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,5,INE435A01028,10,LISTED\n"
+      "INE435A01028,13-May-2009," TEST_WITH_METADATA("+|%marketLotChange,") "APPAPER,International Paper APPM Limited,EQ,10,10,INE435A01028,10,LISTED\n",
+      pipelineExport.str());
+  }
+
+  // input has to be clustered by objectKey
+  {
+    std::ostringstream pipelineExport;
+    t_versionObjectPipeline pipeline{parser,
+      [](const std::string&, t_versionObjectBuilder&, t_versionObject&) {},
+      t_versionObjectPipeline::csvExporter(pipelineExport, sh), 2};
+    std::istringstream input{"INE001A01028,2004,R,A,B,EQ,10,1,INE001A01028,10,LISTED\n"
+                             "INE002A01028,2004,R,A,B,EQ,10,1,INE002A01028,10,LISTED\n"
+                             "INE001A01028,2005,R,A,B,EQ,10,2,INE001A01028,10,LISTED\n"};
+    bool exceptionThrown = false;
+    try {
+      pipeline.run(input);
+    } catch (const dsvo::VO_Pipeline_exception& err) {
+      exceptionThrown = true;
+      std::cout << "TEST_LOG : expected exception : " << err.what() << std::endl;
+    }
+    unittest::ExpectEqual(bool, true, exceptionThrown);
+  }
+}
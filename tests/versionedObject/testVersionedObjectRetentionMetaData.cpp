@@ -0,0 +1 @@
+#include "testVersionedObjectRetentionNoMetaData.cpp"
\ No newline at end of file
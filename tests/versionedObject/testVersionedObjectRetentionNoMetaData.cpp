@@ -0,0 +1,103 @@
+#include <testMergeFixture.h>
+
+
+void loadVO(t_versionObject& voReload,
+            bool firstRun)
+{
+  const dsvo::StreamerHelper sh{};
+  const YearlyVersionDate versionDate{std::chrono::January, 21};
+
+  // versions on 2001, 2003, ..., 2009
+  t_versionObject vo;
+  vo.enableChangeTracking();
+  for(int year = 2001; year < 2010; year += 2)
+    vo.insertVersion(versionDate(year), t_dataSet{TEST_WITH_METADATA(exchangeMeta COMMA) companyInfo(year)});
+  const t_versionObject voFull{vo};
+
+  // the dropped versions go to the archive, the version in effect on the cutoff becomes the baseline
+  std::string archived;
+  auto archive = [&archived, &sh](t_versionObject::t_datasetLedger::const_iterator first,
+                                  t_versionObject::t_datasetLedger::const_iterator last)
+  {
+    for(; first != last; ++first)
+    {
+      std::ostringstream oss;
+      oss << first->first << "," << first->second.toCSV(TEST_WITH_METADATA(sh)) << std::endl;
+      archived += oss.str();
+    }
+  };
+  const t_versionObject::t_generation beforePrune = t_versionObject::getGeneration();
+  unittest::ExpectEqual(size_t, size_t(2), vo.pruneBefore(versionDate(2004), archive));
+  unittest::ExpectEqual(std::string,
+    "21-Jan-2001," TEST_WITH_METADATA("*|*exchange,") "SYM2001,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2003," TEST_WITH_METADATA("*|*exchange,") "SYM2003,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n", archived);
+  const std::string voPrunedStr =
+    "21-Jan-2004," TEST_WITH_METADATA("*|*exchange,") "SYM2003,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2005," TEST_WITH_METADATA("*|*exchange,") "SYM2005,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2007," TEST_WITH_METADATA("*|*exchange,") "SYM2007,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2009," TEST_WITH_METADATA("*|*exchange,") "SYM2009,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voPrunedStr, t_versionObjectStream::createVOstreamer(vo).toCSV(TEST_WITH_METADATA(sh)));
+
+  // same answers from the cutoff on, none before it
+  for(int year = 2000; year <= 2011; ++year)
+  {
+    for(const unsigned day : {20u, 21u, 22u})
+    {
+      const auto prunedIter = vo.getVersionAt(versionDate(year, day));
+      if(versionDate(year, day) < versionDate(2004))
+      {
+        unittest::ExpectEqual(bool, true, prunedIter == vo.getDatasetLedger().cend());
+        continue;
+      }
+      unittest::ExpectEqual(t_dataSet, voFull.getVersionAt(versionDate(year, day))->second, prunedIter->second);
+    }
+  }
+
+  // the baseline is a new version in the change-feed, the dropped versions are gone from it
+  unittest::ExpectEqual(size_t, size_t(1), vo.getVersionsInsertedSince(beforePrune).size());
+  unittest::ExpectEqual(t_versionDate, versionDate(2004), vo.getVersionsInsertedSince(beforePrune).front()->first);
+  unittest::ExpectEqual(size_t, size_t(4), vo.getVersionsInsertedSince(0).size());
+
+  // a cutoff on a version needs no baseline ; one before the first version drops nothing
+  const t_versionObject::t_generation beforeSecondPrune = t_versionObject::getGeneration();
+  unittest::ExpectEqual(size_t, size_t(1), vo.pruneBefore(versionDate(2005)));
+  unittest::ExpectEqual(size_t, size_t(0), vo.getVersionsInsertedSince(beforeSecondPrune).size());
+  unittest::ExpectEqual(size_t, size_t(3), vo.getVersionsInsertedSince(0).size());
+  archived.clear();
+  unittest::ExpectEqual(size_t, size_t(0), vo.pruneBefore(versionDate(2005), archive));
+  unittest::ExpectEqual(size_t, size_t(0), vo.pruneBefore(versionDate(1990), archive));
+  unittest::ExpectEqual(std::string, std::string(""), archived);
+
+  // an archive that fails leaves the versions in place
+  auto failedArchive = [](t_versionObject::t_datasetLedger::const_iterator, t_versionObject::t_datasetLedger::const_iterator)
+                       { throw std::runtime_error("cold storage unavailable"); };
+  ExpectExceptionMsg( vo.pruneBefore(versionDate(2008) COMMA failedArchive), std::runtime_error, "cold storage unavailable");
+  std::cout << "failure_test_end_1" << std::endl;
+  unittest::ExpectEqual(size_t, size_t(3), vo.getDatasetLedger().size());
+
+  // a cutoff after the last version keeps only the baseline
+  t_versionObject voLatest{voFull};
+  unittest::ExpectEqual(size_t, size_t(5), voLatest.pruneBefore(versionDate(2020)));
+  unittest::ExpectEqual(std::string,
+    "21-Jan-2020," TEST_WITH_METADATA("*|*exchange,") "SYM2009,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n",
+    t_versionObjectStream::createVOstreamer(voLatest).toCSV(TEST_WITH_METADATA(sh)));
+
+#if TEST_ENABLE_METADATA == 1
+  // a baseline stamped with its own metaData, not with the one of the version in effect
+  const dsvo::MetaDataSource baselineMeta("baseline", t_eDataBuild::IsRECORD, t_eDataPatch::FullRECORD);
+  t_versionObject voRebased{voFull};
+  unittest::ExpectEqual(size_t, size_t(2), voRebased.pruneBefore(versionDate(2004), baselineMeta,
+                                                                 [](auto, auto) {}));
+  unittest::ExpectEqual(std::string,
+    "*|*baseline,SYM2003,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED",
+    voRebased.getVersionAt(versionDate(2004))->second.toCSV(sh));
+  unittest::ExpectEqual(t_dataSet, voFull.getVersionAt(versionDate(2004))->second, voRebased.getVersionAt(versionDate(2004))->second);
+#endif
+
+  if(firstRun) {
+    unittest::ExpectEqual(std::string, std::string(""), t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+  }
+  voReload = voFull;
+  voReload.pruneBefore(versionDate(2004));
+  unittest::ExpectEqual(std::string, voPrunedStr, t_versionObjectStream::createVOstreamer(voReload).toCSV(TEST_WITH_METADATA(sh)));
+}
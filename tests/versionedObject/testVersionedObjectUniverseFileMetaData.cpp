@@ -0,0 +1 @@
+#include "testVersionedObjectUniverseFileNoMetaData.cpp"
@@ -0,0 +1,95 @@
+#include <testHelper.h>
+
+#include <versionedObject/VersionedObjectUniverseFile.h>
+
+
+using t_versionObjectUniverseFile = dsvo::VersionedObjectUniverseFile<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+void loadVO(t_versionObject& vo,
+            bool insertResultExpected)
+{
+  TEST_WITH_METADATA(dsvo::MetaDataSource listingMeta("listing" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource symChgMeta("symbolChange" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::DELTACHANGE));
+  TEST_WITH_METADATA(symChgMeta.mergeChanges(dsvo::MetaDataSource("nameSpot" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::SNAPSHOT)));
+
+  const t_versionDate listingDate{std::chrono::year(int(2004)), std::chrono::May, std::chrono::day(unsigned(13))};
+  const t_versionDate symChgDate{std::chrono::year(int(2014)), std::chrono::January, std::chrono::day(unsigned(21))};
+
+  t_versionObjectUniverseFile::t_universe universe;
+  universe["INE435A01028"].insertVersion(listingDate,
+          t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) t_convertFromString::ToVal("APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED")});
+  universe["INE435A01028"].insertVersion(symChgDate,
+          t_dataSet{TEST_WITH_METADATA(symChgMeta COMMA) t_convertFromString::ToVal("IPAPPM,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED")});
+  universe["INE144J01027"].insertVersion(t_versionDate{std::chrono::year(int(2008)), std::chrono::October, std::chrono::day(unsigned(6))},
+          t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) t_convertFromString::ToVal("20MICRONS,20 Microns Limited,BE,5,1,INE144J01027,5,LISTED")});
+  universe["INE470A01017"].insertVersion(t_versionDate{std::chrono::year(int(2004)), std::chrono::August, std::chrono::day(unsigned(13))},
+          t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) t_convertFromString::ToVal("3MINDIA,3M India Limited,EQ,10,1,INE470A01017,10,LISTED")});
+  universe["INE000X00000"];  // object without any version
+
+  const std::string universePath = unittest::TempPath();
+  t_versionObjectUniverseFile::write(universePath, universe);
+
+  t_versionObjectUniverseFile::Reader reader{universePath};
+  unittest::ExpectEqual(size_t, 4, reader.size());
+  unittest::ExpectEqual(bool, true, reader.contains("INE435A01028"));
+  unittest::ExpectEqual(bool, false, reader.contains("INE748C01038"));
+
+  t_versionObject missingVO;
+  unittest::ExpectEqual(bool, false, reader.load("INE748C01038", missingVO));
+  unittest::ExpectEqual(size_t, 0, missingVO.getDatasetLedger().size());
+
+  t_versionObject emptyVO;
+  unittest::ExpectEqual(bool, true, reader.load("INE000X00000", emptyVO));
+  unittest::ExpectEqual(size_t, 0, emptyVO.getDatasetLedger().size());
+
+  unittest::ExpectEqual(bool, true, reader.load("INE435A01028", vo));  // seeks directly to the blob
+  unittest::ExpectEqual(t_versionObject, universe["INE435A01028"], vo);
+
+  const dsvo::StreamerHelper sh{};
+  std::string voStr =
+    "13-May-2004," TEST_WITH_METADATA("*|*listing,") "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n"
+    "21-Jan-2014," TEST_WITH_METADATA("+|%symbolChange|@nameSpot,") "IPAPPM,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, voStr, t_versionObjectStream::createVOstreamer(vo).toCSV(TEST_WITH_METADATA(sh)));
+
+  t_versionObject reusedVO{universe["INE435A01028"]};
+  unittest::ExpectEqual(bool, true, reader.load("INE144J01027", reusedVO));  // previous versions are discarded
+  unittest::ExpectEqual(t_versionObject, universe["INE144J01027"], reusedVO);
+
+  t_versionObjectUniverseFile::t_universe reloadedUniverse;
+  reader.loadAll(reloadedUniverse);
+  unittest::ExpectEqual(size_t, universe.size(), reloadedUniverse.size());
+  for(const auto& [objectKey, expectedVO] : universe)
+  {
+    unittest::ExpectEqual(std::string, t_versionObjectStream::createVOstreamer(expectedVO).toCSV(TEST_WITH_METADATA(sh)),
+                                       t_versionObjectStream::createVOstreamer(reloadedUniverse[objectKey]).toCSV(TEST_WITH_METADATA(sh)));
+  }
+
+  universe.erase("INE000X00000");
+  t_versionObjectUniverseFile::write(universePath, universe);  // replaces the existing file
+  unittest::ExpectEqual(bool, false, std::filesystem::exists(universePath + ".tmp"));
+  t_versionObjectUniverseFile::Reader rewrittenReader{universePath};
+  unittest::ExpectEqual(size_t, 3, rewrittenReader.size());
+
+  // a blob with a valid checksum that does not decode : the target object is left as it was
+  {
+    const std::string corruptKey{"INE470A01017"};
+    const t_versionObjectUniverseFile::t_blobLocation location = rewrittenReader.getIndex().at(corruptKey);
+    std::string content = unittest::ReadFile(universePath);
+    content[location.offset] = '\x02';   // version count : 2 instead of 1
+    const uint32_t checksum = dsvo::checksumFNV1a(content.data() + location.offset, location.length);
+    const size_t checksumPos = content.find(corruptKey) + corruptKey.size() + 2*sizeof(uint64_t);
+    for(size_t iii = 0; iii < sizeof(uint32_t); ++iii)
+    {
+      content[checksumPos + iii] = static_cast<char>(static_cast<uint8_t>(checksum >> (8*iii)));
+    }
+    unittest::WriteFile(universePath, content);
+
+    t_versionObjectUniverseFile::Reader corruptReader{universePath};
+    t_versionObject keptVO{universe["INE435A01028"]};
+    ExpectException(corruptReader.load(corruptKey, keptVO), dsvo::VO_Codec_exception);
+    unittest::ExpectEqual(t_versionObject, universe["INE435A01028"], keptVO);
+  }
+
+  VERSIONEDOBJECT_DEBUG_MSG( "DEBUG_LOG: universe-file reload insertResultExpected=" << insertResultExpected);
+  unittest::DeleteFile(universePath);
+}
@@ -0,0 +1 @@
+#include "testVersionedObjectUniverseMergeNoMetaData.cpp"
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <testHelper.h>
+
+#include <versionedObject/VersionedObjectUniverseMerge.h>
+
+
+using t_versionObjectPriorityMerge         = dsvo::VersionedObjectPriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+using t_versionObjectUniversePriorityMerge = dsvo::VersionedObjectUniversePriorityMerge<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+// map allocator failing with bad_alloc once 'mapNodeBudget' node allocations are spent ( < 0 : no limit )
+inline int mapNodeBudget = -1;
+template<typename T>
+struct BudgetAllocator
+{
+  using value_type = T;
+
+  BudgetAllocator() = default;
+  template<typename U> BudgetAllocator(const BudgetAllocator<U>&) {}
+
+  T* allocate(size_t count)
+  {
+    if(mapNodeBudget == 0)
+      throw std::bad_alloc{};
+    if(mapNodeBudget > 0)
+      --mapNodeBudget;
+    return std::allocator<T>{}.allocate(count);
+  }
+  void deallocate(T* ptr, size_t count) { std::allocator<T>{}.deallocate(ptr, count); }
+
+  template<typename U> bool operator==(const BudgetAllocator<U>&) const { return true; }
+};
+using t_budgetUniverse = std::map<std::string, t_versionObject, std::less<std::string>,
+                                  BudgetAllocator<std::pair<const std::string, t_versionObject>>>;
+
+void loadVO(t_versionObject& vo,
+            bool insertResultExpected)
+{
+  TEST_WITH_METADATA(dsvo::MetaDataSource crownMeta("crown" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource manualMeta("manualDeduction" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+
+  const t_versionDate listingDate{std::chrono::year(int(2004)), std::chrono::May, std::chrono::day(unsigned(13))};
+  t_companyInfo companyInfo = t_convertFromString::ToVal(
+    "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED"    );
+  bool insertResult = vo.insertVersion(listingDate, t_dataSet{TEST_WITH_METADATA(crownMeta COMMA) companyInfo});
+  unittest::ExpectEqual(bool, insertResultExpected, insertResult);
+
+  auto isinOf = [](int iii) {
+    std::ostringstream objectKey;
+    objectKey << "INE" << std::setw(3) << std::setfill('0') << iii << "A01028";
+    return objectKey.str();
+  };
+  // object 'iii' has (iii % 5)+1 yearly versions
+  auto fillVersions = [&companyInfo, &isinOf](t_versionObject& universeVO, int iii TEST_WITH_METADATA(COMMA const dsvo::MetaDataSource& sourceMeta))
+  {
+    for(int jjj = 0; jjj <= (iii % 5); ++jjj)
+    {
+      std::get<0>(companyInfo) = "SYM" + std::to_string(iii);
+      std::get<4>(companyInfo) = static_cast<t_marketLot>(jjj + 1);
+      std::get<5>(companyInfo) = isinOf(iii);
+      const t_versionDate versionDate{std::chrono::year(int(2004 + jjj)), std::chrono::May, std::chrono::day(unsigned(13))};
+      universeVO.insertVersion(versionDate, t_dataSet{TEST_WITH_METADATA(sourceMeta COMMA) companyInfo});
+    }
+  };
+
+  // high-priority : objects 0..39, low-priority : objects 20..59, overlapping on 20..39
+  std::map<std::string, t_versionObject> highPriorityUniverse, lowrPriorityUniverse;
+  for(int iii = 0; iii < 40; ++iii)
+    fillVersions(highPriorityUniverse[isinOf(iii)], iii TEST_WITH_METADATA(COMMA crownMeta));
+  for(int iii = 20; iii < 60; ++iii)
+    fillVersions(lowrPriorityUniverse[isinOf(iii)], iii TEST_WITH_METADATA(COMMA manualMeta));
+  highPriorityUniverse["INE435A01028"] = vo;
+
+  // object 33 : the sources disagree on the record of a version
+  std::get<4>(companyInfo) = static_cast<t_marketLot>(5);
+  std::get<5>(companyInfo) = isinOf(33);
+  const t_versionDate mismatchDate{std::chrono::year(int(2010)), std::chrono::May, std::chrono::day(unsigned(13))};
+  std::get<0>(companyInfo) = "SYM33_HIGH";
+  highPriorityUniverse[isinOf(33)].insertVersion(mismatchDate, t_dataSet{TEST_WITH_METADATA(crownMeta COMMA) companyInfo});
+  std::get<0>(companyInfo) = "SYM33_LOWR";
+  lowrPriorityUniverse[isinOf(33)].insertVersion(mismatchDate, t_dataSet{TEST_WITH_METADATA(manualMeta COMMA) companyInfo});
+
+  // expected : the pairwise merge key by key, without the failing object
+  std::map<std::string, t_versionObject> expectedUniverse;
+  const t_versionObject emptyVO;
+  for(int iii = 0; iii < 60; ++iii)
+  {
+    if(iii == 33) continue;
+    const std::string isin = isinOf(iii);
+    t_versionObjectPriorityMerge{ iii < 40 ? highPriorityUniverse.at(isin) : emptyVO,
+                                  iii >= 20 ? lowrPriorityUniverse.at(isin) : emptyVO }.getMergeResult(expectedUniverse[isin]);
+  }
+  expectedUniverse["INE435A01028"] = vo;
+
+  for(const size_t threadCount : std::vector<size_t>{1, 2, 4})
+  {
+    std::map<std::string, t_versionObject> mergeUniverse;
+    mergeUniverse["INE435A01028"] = vo;   // existing object, merged into
+    const dsvo::UniverseMergeReport<std::string> report =
+        t_versionObjectUniversePriorityMerge::merge(highPriorityUniverse, lowrPriorityUniverse, mergeUniverse, threadCount, 4);
+
+    unittest::ExpectEqual(size_t, size_t(60), report.mergedObjects);
+    unittest::ExpectEqual(size_t, size_t(1), report.failures.size());
+    unittest::ExpectEqual(std::string, isinOf(33), report.failures.front().first);
+    unittest::ExpectEqual(std::string,
+      "ERROR : failure in VersionedObjectPriorityMerge<VDT, MT...>::getMergeResult() : different 'record' exits between 2 merge-candidates of VersionedObject",
+      report.failures.front().second);
+    unittest::ExpectEqual(bool, true, mergeUniverse == expectedUniverse);
+    unittest::ExpectEqual(bool, true, mergeUniverse.find(isinOf(33)) == mergeUniverse.end());
+
+    size_t expectedVersions = 0;
+    for(const auto& [isin, expectedVO] : expectedUniverse)
+      expectedVersions += expectedVO.getDatasetLedger().size();
+    unittest::ExpectEqual(size_t, expectedVersions, report.mergedVersions);
+    unittest::ExpectEqual(bool, true, report.objectsPerSecond() > 0.0 && report.versionsPerSecond() > 0.0);
+    std::cout << "threadCount=" << threadCount << " : mergedObjects=" << report.mergedObjects
+              << " failures=" << report.failures.size() << std::endl;
+  }
+
+  // a non-data failure (here bad_alloc) leaves the merge universe as it was
+  t_budgetUniverse budgetHigh, budgetLowr, budgetMerge;
+  for(int iii = 0; iii < 20; ++iii)
+  {
+    budgetHigh[isinOf(iii)] = highPriorityUniverse.at(isinOf(iii));
+    budgetLowr[isinOf(iii + 20)] = lowrPriorityUniverse.at(isinOf(iii + 20));
+  }
+  budgetMerge["INE435A01028"] = vo;
+  const t_budgetUniverse budgetMergeBefore{budgetMerge};
+  mapNodeBudget = 10;
+  ExpectException(t_versionObjectUniversePriorityMerge::merge(budgetHigh COMMA budgetLowr COMMA budgetMerge COMMA 2), std::bad_alloc);
+  mapNodeBudget = -1;
+  unittest::ExpectEqual(bool, true, budgetMerge == budgetMergeBefore);
+
+  std::map<std::string, t_versionObject> emptyMerge;
+  const dsvo::UniverseMergeReport<std::string> emptyReport =
+      t_versionObjectUniversePriorityMerge::merge(std::map<std::string, t_versionObject>{}, std::map<std::string, t_versionObject>{}, emptyMerge, 4);
+  unittest::ExpectEqual(size_t, size_t(0), emptyReport.mergedObjects);
+  unittest::ExpectEqual(bool, true, emptyMerge.empty() && emptyReport.failures.empty());
+}
@@ -0,0 +1 @@
+#include "testVersionedObjectUniverseStreamNoMetaData.cpp"
@@ -0,0 +1,70 @@
+#include <testHelper.h>
+
+#include <versionedObject/VersionedObjectUniverseStream.h>
+
+
+using t_versionObjectUniverseStream = dsvo::VersionedObjectUniverseStream<t_versionDate, COMPANYMETAINFO_TYPE_LIST>;
+
+void loadVO(t_versionObject& vo,
+            bool insertResultExpected)
+{
+  TEST_WITH_METADATA(dsvo::MetaDataSource listingMeta("listing" COMMA t_eDataBuild::IsRECORD COMMA t_eDataPatch::FullRECORD));
+  TEST_WITH_METADATA(dsvo::MetaDataSource lotChgMeta("marketLotChange" COMMA t_eDataBuild::FORWARD COMMA t_eDataPatch::DELTACHANGE));
+
+  const t_versionDate listingDate{std::chrono::year(int(2004)), std::chrono::May, std::chrono::day(unsigned(13))};
+  t_companyInfo companyInfo = t_convertFromString::ToVal(
+    "APPAPER,International Paper APPM Limited,EQ,10,1,INE435A01028,10,LISTED"    );
+  bool insertResult = vo.insertVersion(listingDate, t_dataSet{TEST_WITH_METADATA(listingMeta COMMA) companyInfo});
+  unittest::ExpectEqual(bool, insertResultExpected, insertResult);
+
+  // a universe with skewed object sizes : object 'iii' has (iii % 7) versions
+  std::map<std::string, t_versionObject> universe;
+  for(int iii = 0; iii < 61; ++iii)
+  {
+    std::ostringstream objectKey;
+    objectKey << "INE" << std::setw(3) << std::setfill('0') << iii << "A01028";
+    t_versionObject& universeVO = universe[objectKey.str()];
+    for(int jjj = 0; jjj <= (iii % 7); ++jjj)
+    {
+      std::get<0>(companyInfo) = "SYM" + std::to_string(iii);
+      std::get<4>(companyInfo) = static_cast<t_marketLot>(jjj + 1);
+      std::get<5>(companyInfo) = objectKey.str();
+      const t_versionDate versionDate{std::chrono::year(int(2004 + jjj)), std::chrono::May, std::chrono::day(unsigned(13))};
+      universeVO.insertVersion(versionDate, t_dataSet{TEST_WITH_METADATA((jjj==0 ? listingMeta : lotChgMeta) COMMA) companyInfo});
+    }
+  }
+  universe["INE435A01028"] = vo;
+  universe["INE999Z99999"];   // object without any version
+
+  const dsvo::StreamerHelper sh{};
+  std::ostringstream sequentialExport;
+  t_versionObjectUniverseStream::toCSVSequential(universe, sequentialExport, sh);
+
+  std::ostringstream expectedFirstLines;
+  expectedFirstLines << "INE000A01028,13-May-2004," TEST_WITH_METADATA("*|*listing,") "SYM0,International Paper APPM Limited,EQ,10,1,INE000A01028,10,LISTED\n"
+                     << "INE001A01028,13-May-2004," TEST_WITH_METADATA("*|*listing,") "SYM1,International Paper APPM Limited,EQ,10,1,INE001A01028,10,LISTED\n"
+                     << "INE001A01028,13-May-2005," TEST_WITH_METADATA("+|%marketLotChange,") "SYM1,International Paper APPM Limited,EQ,10,2,INE001A01028,10,LISTED\n";
+  unittest::ExpectEqual(std::string, expectedFirstLines.str(), sequentialExport.str().substr(0, expectedFirstLines.str().size()));
+
+  for(const size_t threadCount : std::vector<size_t>{1, 2, 3, 4, 8})
+  {
+    for(const size_t chunksPerThread : std::vector<size_t>{1, 4, 100})
+    {
+      std::ostringstream parallelExport;
+      t_versionObjectUniverseStream::toCSV(universe, parallelExport, sh, threadCount, chunksPerThread);
+      unittest::ExpectEqual(std::string, sequentialExport.str(), parallelExport.str());
+    }
+  }
+
+  std::ostringstream emptyExport;
+  t_versionObjectUniverseStream::toCSV(std::map<std::string, t_versionObject>{}, emptyExport, sh, 4);
+  unittest::ExpectEqual(std::string, std::string(""), emptyExport.str());
+
+  const std::string exportPath = unittest::TempPath();
+  t_versionObjectUniverseStream::toCSVFile(universe, exportPath, sh);
+  unittest::ExpectEqual(std::string, sequentialExport.str(), unittest::ReadFile(exportPath));
+  unittest::DeleteFile(exportPath);
+
+  ExpectException( t_versionObjectUniverseStream::toCSVFile(universe, exportPath + "/noSuchDir/export.csv", sh),
+                   dsvo::VO_UniverseStream_IO_exception );
+}